@@ -0,0 +1,136 @@
+#!/bin/sh
+# Generates a variant of the main.cpp example with a schema of the given size,
+# instrumented for the startup benchmark (see startup.cpp):
+#
+#   gen_startup.sh <options> <commands> > variant.cpp
+#
+# The variant measures, from main() entry to parse completion, the wall time
+# and the number of heap allocations, and writes "<nanoseconds> <allocations>".
+
+options=${1:-10}
+commands=${2:-0}
+
+cat <<'HEAD'
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "usage.hpp"
+
+static size_t allocations = 0;
+
+// every form of new is counted: single and array, throwing and nothrow,
+// default and over-aligned
+static void* allocate(size_t n, size_t align = 0) {
+
+	allocations++;
+	n = n ? n : 1;
+
+	if ( align == 0 )
+		return std::malloc(n);
+
+	return std::aligned_alloc(align, ( n + align - 1 ) / align * align);
+}
+
+static void* allocate_or_throw(size_t n, size_t align = 0) {
+
+	if ( void* p = allocate(n, align))
+		return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t n) { return allocate_or_throw(n); }
+void* operator new[](size_t n) { return allocate_or_throw(n); }
+void* operator new(size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new(size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+HEAD
+
+# the options as a plain table turned into the schema's options at startup:
+# one braced initializer of a thousand options takes the compiler minutes at
+# -O2, this takes no longer than at -O0
+printf '\n// generated options: name, key, word, desc, flag, arg name, type\n'
+printf 'static const struct {\n\tconst char *option, *key, *word, *desc;\n\tusage_t::arg_flag flag;\n\tconst char* name;\n\tusage_t::arg_type type;\n} specs[] = {\n'
+
+i=0
+while [ "$i" -lt "$options" ]; do
+	case $(( i % 4 )) in
+		0) extra='usage_t::REQUIRED, "value", usage_t::STRING' ;;
+		1) extra='usage_t::REQUIRED, "number", usage_t::INT' ;;
+		2) extra='usage_t::OPTIONAL, "value", usage_t::STRING' ;;
+		*) extra='usage_t::NO, "", usage_t::STRING' ;;
+	esac
+	sep=','; [ "$i" -eq $(( options - 1 )) ] && sep=''
+	printf '\t{ "option%d", "o%d", "option%d", "generated option number %d", %s }%s\n' \
+		"$i" "$i" "$i" "$i" "$extra" "$sep"
+	i=$(( i + 1 ))
+done
+
+cat <<'MAIN'
+};
+
+int main(int argc, char **argv) {
+
+	auto start = std::chrono::steady_clock::now();
+	size_t allocs = allocations;
+
+	std::vector<std::pair<std::string, usage_t::option_t>> options;
+	options.reserve(sizeof(specs) / sizeof(specs[0]));
+
+	for ( const auto& s : specs )
+		options.push_back({ s.option, { .key = s.key, .word = s.word, .desc = s.desc, .flag = s.flag, .name = s.name, .type = s.type }});
+
+	usage_t usage = {
+		.args = { argc, argv },
+		.info = {
+			.name = "startup",
+			.version = "1.0.0",
+			.author = "usage_cpp benchmark",
+			.description = "\nGenerated schema for the startup benchmark\n"
+		},
+		.options = std::move(options),
+MAIN
+
+printf '\t\t.commands = {\n'
+
+c=0
+while [ "$c" -lt "$commands" ]; do
+	sep=','; [ "$c" -eq $(( commands - 1 )) ] && sep=''
+	printf '\t\t\t{ "command%d", std::make_shared<usage_t>(usage_t{\n' "$c"
+	printf '\t\t\t\t.info = { .description = "\\n   command%d [options]   generated command\\n" },\n' "$c"
+	printf '\t\t\t\t.options = {\n'
+	printf '\t\t\t\t\t{ "name", { .key = "n", .word = "name", .desc = "a name", .flag = usage_t::REQUIRED, .name = "name" }},\n'
+	printf '\t\t\t\t\t{ "count", { .key = "c", .word = "count", .desc = "a count", .flag = usage_t::REQUIRED, .name = "number", .type = usage_t::INT }},\n'
+	printf '\t\t\t\t\t{ "force", { .key = "f", .word = "force", .desc = "no questions asked" }}\n'
+	printf '\t\t\t\t}\n\t\t\t}) }%s\n' "$sep"
+	c=$(( c + 1 ))
+done
+
+cat <<'TAIL'
+		}
+	};
+
+	auto end = std::chrono::steady_clock::now();
+	allocs = allocations - allocs;
+
+	std::printf("%lld %zu\n", (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), allocs);
+	return usage.validated ? 0 : 1;
+}
+TAIL
@@ -0,0 +1,123 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "usage.hpp"
+
+// Command loop benchmark: feeds a script of generated command lines through
+// usage_t::loop_t, and for comparison through a per-line loop - getline, a
+// fresh usage_t for each line, output flushed after each command - and reports
+// commands per second of both:
+//
+//   loop [lines]
+
+static std::shared_ptr<usage_t> command(bool value) {
+
+	usage_t::option_t key = { .key = "k", .word = "key", .desc = "key", .flag = usage_t::arg_flag::REQUIRED };
+	usage_t::option_t val = { .key = "v", .word = "value", .desc = "value", .flag = usage_t::arg_flag::REQUIRED, .type = usage_t::arg_type::INT };
+
+	if ( value )
+		return std::make_shared<usage_t>(usage_t{ .options = {{ "key", key }, { "value", val }}});
+	return std::make_shared<usage_t>(usage_t{ .options = {{ "key", key }}});
+}
+
+static usage_t schema(usage_t::args_t args = {}) {
+
+	return usage_t{
+		.args = args,
+		.options = {{ "verbose", { .key = "V", .word = "verbose", .desc = "verbose output" }}},
+		.commands = {{ "set", command(true) }, { "get", command(false) }, { "del", command(false) }}
+	};
+}
+
+static std::string script(size_t lines) {
+
+	std::string s;
+
+	for ( size_t i = 0; i < lines; i++ ) {
+		if ( i % 3 == 0 ) s += "set --key \"item " + std::to_string(i) + "\" -v " + std::to_string(i * 7) + "\n";
+		else if ( i % 3 == 1 ) s += "get -k 'item " + std::to_string(i - 1) + "'\n";
+		else s += "del --key=item" + std::to_string(i - 2) + "\n";
+	}
+
+	return s;
+}
+
+// the script as a file to read from, rewound
+static int input(const std::string& s) {
+
+	FILE* f = std::tmpfile();
+	std::fwrite(s.data(), 1, s.size(), f);
+	std::fflush(f);
+	int fd = dup(fileno(f));
+	std::fclose(f);
+	lseek(fd, 0, SEEK_SET);
+	return fd;
+}
+
+static void report(const char* name, size_t lines, std::chrono::steady_clock::duration d) {
+
+	double s = std::chrono::duration<double>(d).count();
+	std::cout << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(1) <<
+		std::setw(12) << lines / s << " commands/s  " << std::setw(8) << s * 1000.0 << "ms" << std::endl;
+}
+
+int main(int argc, char **argv) {
+
+	size_t lines = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+	std::string s = script(lines);
+	int null = open("/dev/null", O_WRONLY);
+
+	usage_t shared = schema();
+	auto handler = [](const usage_t::parsed_t& res, std::string& out) {
+		out += res.command + " " + res.sub -> value("key") + "\n";
+	};
+
+	usage_t::loop_t loop = { .schema = &shared, .commands = {{ "set", handler }, { "get", handler }, { "del", handler }}};
+
+	int fd = input(s);
+	auto start = std::chrono::steady_clock::now();
+	size_t n = loop.run(fd, null);
+	report("loop_t", n, std::chrono::steady_clock::now() - start);
+	close(fd);
+
+	// per line: a usage_t built from words, output flushed each time
+	std::istringstream in(s);
+	std::string line;
+	FILE* out = fdopen(null, "w");
+	n = 0;
+	start = std::chrono::steady_clock::now();
+
+	while ( std::getline(in, line)) {
+
+		std::istringstream ws(line);
+		std::vector<std::string> words = { "loop" };
+		std::string w;
+
+		while ( ws >> w )
+			words.push_back(w);
+
+		std::vector<char*> av;
+		for ( auto& word : words )
+			av.push_back(word.data());
+		av.push_back(nullptr);
+
+		usage_t u = schema({ (int)words.size(), av.data() });
+
+		std::fprintf(out, "%s\n", u.subcommand().c_str());
+		std::fflush(out);
+		n++;
+	}
+
+	report("per line", n, std::chrono::steady_clock::now() - start);
+	std::fclose(out);
+	return 0;
+}
@@ -0,0 +1,110 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+// Startup benchmark driver: runs a variant generated by gen_startup.sh many
+// times and reports percentiles of the whole exec (spawn to exit) and of the
+// variant's own measurement, main() entry to parse completion:
+//
+//   startup <runs> <variant> [args..]
+
+extern char **environ;
+
+struct sample_t {
+	long long exec_ns;
+	long long parse_ns;
+	size_t allocs;
+};
+
+template <typename T>
+static T percentile(std::vector<T> v, double p) {
+
+	std::sort(v.begin(), v.end());
+	return v[std::min(v.size() - 1, (size_t)( p * v.size()))];
+}
+
+static bool run(char **argv, sample_t& s) {
+
+	int fd[2];
+	if ( pipe(fd) != 0 )
+		return false;
+
+	posix_spawn_file_actions_t fa;
+	posix_spawn_file_actions_init(&fa);
+	posix_spawn_file_actions_adddup2(&fa, fd[1], STDOUT_FILENO);
+	posix_spawn_file_actions_addclose(&fa, fd[0]);
+
+	auto start = std::chrono::steady_clock::now();
+	pid_t pid;
+	int rc = posix_spawn(&pid, argv[0], &fa, nullptr, argv, environ);
+	posix_spawn_file_actions_destroy(&fa);
+	close(fd[1]);
+
+	if ( rc != 0 ) {
+		close(fd[0]);
+		return false;
+	}
+
+	char buf[128];
+	ssize_t n, len = 0;
+	while ( len < (ssize_t)sizeof(buf) - 1 && ( n = read(fd[0], buf + len, sizeof(buf) - 1 - len)) > 0 )
+		len += n;
+	buf[len] = 0;
+	close(fd[0]);
+
+	int status;
+	waitpid(pid, &status, 0);
+	s.exec_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+	return std::sscanf(buf, "%lld %zu", &s.parse_ns, &s.allocs) == 2;
+}
+
+int main(int argc, char **argv) {
+
+	if ( argc < 3 ) {
+		std::cerr << "usage: " << argv[0] << " <runs> <variant> [args..]" << std::endl;
+		return 1;
+	}
+
+	int runs = std::atoi(argv[1]);
+	std::vector<sample_t> samples;
+
+	for ( int i = 0; i < runs; i++ ) {
+
+		sample_t s;
+		if ( !run(argv + 2, s)) {
+			std::cerr << "failed to run " << argv[2] << std::endl;
+			return 1;
+		}
+		samples.push_back(s);
+	}
+
+	std::vector<long long> exec_ns, parse_ns;
+	std::vector<size_t> allocs;
+
+	for ( const auto& s : samples ) {
+		exec_ns.push_back(s.exec_ns);
+		parse_ns.push_back(s.parse_ns);
+		allocs.push_back(s.allocs);
+	}
+
+	std::cout << std::left << std::setw(28) << argv[2] << std::right << std::fixed << std::setprecision(1);
+
+	for ( double p : { 0.5, 0.9, 0.99 })
+		std::cout << "  exec p" << std::setw(2) << (int)( p * 100 ) << " " << std::setw(8) << percentile(exec_ns, p) / 1000.0 << "us";
+
+	for ( double p : { 0.5, 0.9, 0.99 })
+		std::cout << "  parse p" << std::setw(2) << (int)( p * 100 ) << " " << std::setw(8) << percentile(parse_ns, p) / 1000.0 << "us";
+
+	std::cout << "  allocs " << percentile(allocs, 0.5) << std::endl;
+	return 0;
+}
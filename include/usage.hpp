@@ -1,16 +1,26 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <vector>
 #include <memory>
 #include <utility>
 #include <algorithm>
 #include <unordered_map>
+#include <list>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <cstdint>
+#include <type_traits>
 
 class usage_t {
 
 	public:
 		struct error_t;
+		struct error_ref_t;
+		struct variadic_t;
+		struct help_cache_t;
 
 	private:
 
@@ -22,7 +32,7 @@ class usage_t {
 				validator_t(usage_t *u);
 
 				std::unordered_map<std::string, std::string> values;
-				std::vector<usage_t::error_t> errors;
+				std::vector<usage_t::error_ref_t> errors;   // see errors()
 				std::vector<std::string> remainder;
 
 				// subcommands: the matched command (if any), its own usage_t
@@ -31,6 +41,12 @@ class usage_t {
 				std::string command;
 				usage_t* sub = nullptr;
 				std::vector<std::string> tail;
+				char* const* passthrough = nullptr;   // the command's slice of the original argv
+
+				// the variadic positional slot's values, converted (nullptr if none)
+				std::shared_ptr<usage_t::variadic_t> variadic;
+
+				struct sink_t;
 
 				size_t size() const;
 
@@ -52,6 +68,10 @@ class usage_t {
 			UNKNOWN_OPTION, MISSING_ARG, ARG_VALIDATION, DUPLICATE
 		};
 
+		enum doc_type {
+			TEXT, MAN, MARKDOWN, JSON
+		};
+
 		struct error_t {
 			std::string name;
 			usage_t::error_type error;
@@ -59,13 +79,46 @@ class usage_t {
 			std::string value;
 		};
 
+		// an enum kept in a byte, read and written as the enum itself
+		template <typename E>
+		struct narrow_t {
+
+			uint8_t value;
+
+			narrow_t(E e = E()) : value((uint8_t)e) {}
+			operator E() const { return (E)this -> value; }
+		};
+
+		// an error as the parser records it: fixed size, no text - name and
+		// value are read back from the argument it refers to when an error_t
+		// is asked for (see errors())
+		struct error_ref_t {
+			narrow_t<usage_t::error_type> error;
+			narrow_t<usage_t::arg_type> type = usage_t::arg_type::STRING;
+			bool positional = false;   // option and arg are then a positional slot and remainder() index
+			int32_t option = -1;       // index in options, -1 for an unknown option
+			uint32_t arg = 0;          // index of the argument
+			uint32_t offset = 0;       // where the name (unknown) or value starts in it, ~0: no value
+		};
+
 		class args_t {
 				friend class validator_t;
+				friend class usage_t;
 
 			private:
 				std::string _cmd;
 				std::vector<std::string> _vec;
 
+				// the original, null-terminated argv (_vec[i] is _argv[i + 1]),
+				// when built from one; left untouched, never copied
+				char* const* _argv = nullptr;
+
+				// a subcommand's, set on dispatch: the hidden entry points
+				// (__complete, __export, __parse) are the root's only
+				bool _dispatched = false;
+
+				bool marker(const std::string& name) const;   // name is argv[1]
+
 			public:
 
 				bool empty() const;
@@ -77,6 +130,90 @@ class usage_t {
 				args_t(const int argc, char **argv);
 		};
 
+		// a variable an option's value is written to as it is parsed, converted
+		// once to the variable's type. A callable taking the value string binds
+		// anything else (return false to reject the value).
+		class bind_t {
+
+			private:
+				enum kind_t { NONE, INT64, DOUBLE, BOOL, STRING, UINT32, CUSTOM };
+
+				kind_t _kind = NONE;
+				void* _ptr = nullptr;
+				std::function<bool(const std::string&)> _custom;
+
+			public:
+
+				bind_t() = default;
+				bind_t(int64_t& v) : _kind(INT64), _ptr(&v) {}
+				bind_t(double& v) : _kind(DOUBLE), _ptr(&v) {}
+				bind_t(bool& v) : _kind(BOOL), _ptr(&v) {}
+				bind_t(std::string& v) : _kind(STRING), _ptr(&v) {}
+				bind_t(uint32_t& v) : _kind(UINT32), _ptr(&v) {}
+
+				template <typename F, typename = std::enable_if_t<std::is_invocable_r_v<bool, F, const std::string&>>>
+				bind_t(F f) : _kind(CUSTOM), _custom(std::move(f)) {}
+
+				explicit operator bool() const;
+
+				// writes a checked value of the given type; an option given
+				// without a value only sets a bool. False if it does not fit.
+				bool assign(const std::string& value, arg_type type) const;
+		};
+
+		// an option's value when it is not given (see operator[] and value()):
+		// a constant, or worked out by a callback - only when first asked
+		// for, at most once. Copies share what was worked out; options of
+		// different types sharing one have it checked for each type.
+		class default_t {
+
+			private:
+				static constexpr size_t types = usage_t::arg_type::HEX + 1;
+
+				struct state_t {
+					std::once_flag once;
+					std::function<std::string()> make;
+					std::string value;
+
+					// per arg_type: checked once, normalised as a given value is
+					std::once_flag checked[types];
+					std::string typed[types];
+					bool fits[types] = {};
+				};
+
+				std::shared_ptr<state_t> _state;
+
+			public:
+
+				default_t() = default;
+				default_t(const char* value);
+				default_t(const std::string& value);
+
+				template <typename F, typename = std::enable_if_t<std::is_invocable_r_v<std::string, F>>>
+				default_t(F f) : _state(std::make_shared<state_t>()) {
+					this -> _state -> make = std::move(f);
+				}
+
+				explicit operator bool() const;
+				bool callable() const;
+
+				// worked out on first use and checked against the option's
+				// type, normalised as a given value is; throws
+				// std::invalid_argument if it does not fit
+				const std::string& value(arg_type type) const;
+		};
+
+		// an option's fallback and the type it is read as
+		struct fallback_t {
+			default_t fallback;
+			arg_type type = usage_t::arg_type::STRING;
+		};
+
+		// the options of one command that have a fallback, by name: built once
+		// per schema and shared by every result parsed against it - an option
+		// is not given when it is not in the result's values
+		using fallbacks_t = std::unordered_map<std::string, fallback_t>;
+
 		struct option_t {
 
 			public:
@@ -86,6 +223,29 @@ class usage_t {
 				arg_flag flag = usage_t::arg_flag::NO;
 				std::string name;
 				arg_type type = usage_t::arg_type::STRING;
+				bind_t bind;
+				default_t fallback;       // value when not given
+		};
+
+		// a typed positional argument slot, see `positionals`
+		struct positional_t {
+			std::string name;
+			std::string desc;
+			arg_type type = usage_t::arg_type::STRING;
+			bool variadic = false;    // takes all the rest; last slot only
+		};
+
+		// the variadic slot's values, converted to its type into one
+		// contiguous array: ints for INT and BOOL (0/1), hex for HEX (up to
+		// 64 bits), floats for FLOAT and strings for STRING
+		struct variadic_t {
+			usage_t::arg_type type = usage_t::arg_type::STRING;
+			std::vector<int64_t> ints;
+			std::vector<uint64_t> hex;
+			std::vector<double> floats;
+			std::vector<std::string> strings;
+
+			size_t size() const;
 		};
 
 		struct result_t {
@@ -105,6 +265,200 @@ class usage_t {
 				long hexValue() const;
 		};
 
+		// event-driven parsing, see parse(): each is called as the parser meets
+		// the item, nothing is stored. Any of them may be left unset.
+		struct handler_t {
+			std::function<void(const std::string& name, const result_t& value)> option;
+			std::function<void(const std::string& arg)> positional;
+			std::function<void(const std::string& name, const usage_t* command)> command;   // nullptr: raw
+			std::function<void(const error_t& error)> error;
+		};
+
+		// an immutable parse result, see parse(args) and cache_t
+		struct parsed_t {
+			std::unordered_map<std::string, std::string> values;
+			std::vector<usage_t::error_t> errors;
+			std::vector<std::string> remainder;
+			std::string command;                      // matched subcommand ("" if none)
+			std::shared_ptr<const parsed_t> sub;      // its result (nullptr if raw / none)
+			std::vector<std::string> tail;            // raw arguments after the command
+			std::shared_ptr<const variadic_t> variadic;   // the variadic slot's values (nullptr if none)
+			std::shared_ptr<const fallbacks_t> fallbacks;   // the schema's (nullptr if none)
+
+			operator bool() const;                    // no errors
+
+			// errors of this result and of the subcommand results below it,
+			// first the outermost; counted without copying any
+			size_t error_count() const;
+			const usage_t::error_t* first_error() const;   // nullptr if none
+
+			// as usage_t's: not enabled when not given, its value then being
+			// its fallback (if any)
+			result_t operator [](const std::string& name) const;
+			result_t operator [](const char* name) const;
+			std::string value(const std::string& name) const;
+		};
+
+		// bounded LRU cache in front of the parser, for long running programs that
+		// parse the same few command lines over and over: a hit costs hashing and
+		// comparing the arguments, the parser does not run at all. Not thread-safe.
+		class cache_t {
+
+			private:
+				struct entry_t {
+					uint64_t hash;
+					std::vector<std::string> args;
+					std::shared_ptr<const parsed_t> result;
+				};
+
+				const usage_t* _schema;
+				size_t _capacity;
+				std::list<entry_t> _lru;                                   // most recent first
+				std::unordered_multimap<uint64_t, std::list<entry_t>::iterator> _index;
+				size_t _hits = 0;
+				size_t _misses = 0;
+
+			public:
+				cache_t(const usage_t& schema, size_t capacity = 256);
+
+				std::shared_ptr<const parsed_t> parse(const std::vector<std::string>& args);
+
+				size_t size() const;
+				size_t hits() const;
+				size_t misses() const;
+				void clear();
+		};
+
+		// parses a command line as it is being edited (an interactive console
+		// validating on every keystroke): the parser's state is kept for every
+		// argument, so a changed line is parsed again only from its first
+		// changed argument on. Read only, like parse(args); not thread-safe.
+		class incremental_t {
+
+			private:
+				struct state_t;
+				std::shared_ptr<state_t> _state;
+
+			public:
+				incremental_t(const usage_t& schema);
+
+				std::shared_ptr<const parsed_t> parse(const std::vector<std::string>& args);
+
+				size_t reparsed() const;             // arguments parsed by the last parse()
+				void clear();
+		};
+
+		// a command loop over a stream of command lines (stdin, a pipe, a
+		// script): input is read in large blocks and split into lines and
+		// words in place, each line is parsed against the one schema and its
+		// result handed to the handler of its command. Handlers append their
+		// output to out, which is written in batches - when it grows large and
+		// before waiting for more input. Words are split at whitespace; quotes
+		// ('', "") and backslashes work as in a shell, # starts a comment.
+		struct loop_t {
+
+			using command_t = std::function<void(const parsed_t& result, std::string& out)>;
+
+			const usage_t* schema;
+			std::unordered_map<std::string, command_t> commands;   // by command name, "": no command
+			command_t error;                           // lines with errors at any level; unset: they are printed
+
+			size_t run(int in = 0, int out = 1) const;   // reads in to its end, returns lines parsed
+		};
+
+		// a schema that is replaced at runtime while other threads parse against
+		// it (plugins adding commands, ...). Readers take a snapshot without
+		// waiting on writers; a replaced schema is released with its last
+		// snapshot - results of parse() hold one.
+		class handle_t {
+
+			private:
+				std::shared_ptr<const usage_t> _current;
+				std::mutex _writer;                       // serialises update()
+
+				static std::shared_ptr<usage_t> clone(const usage_t& u);
+
+			public:
+				handle_t(std::shared_ptr<const usage_t> schema = nullptr);
+
+				std::shared_ptr<const usage_t> snapshot() const;
+				void replace(std::shared_ptr<const usage_t> schema);
+
+				// copy-on-write: modify a deep copy of the current schema (its
+				// commands tree included) and publish it
+				void update(const std::function<void(usage_t& schema)>& modify);
+
+				std::shared_ptr<const parsed_t> parse(const std::vector<std::string>& args) const;
+		};
+
+		// A compiled, read-only schema: options, commands tree, lookup indexes and
+		// pre-rendered help in one flat, versioned image. Built from a usage_t, it
+		// can be written to a file and mapped back in by later runs, which then
+		// skip constructing the usage_t altogether - the parser works on the
+		// image directly. Bound variables do not carry over.
+		class schema_t {
+
+			private:
+				const unsigned char* _data = nullptr;
+				size_t _size = 0;
+				std::vector<unsigned char> _image;    // built in memory, unless mapped
+				bool _mapped = false;
+				std::vector<std::shared_ptr<const fallbacks_t>> _fallbacks;   // per node, from the image or the compiled usage_t
+
+				schema_t() = default;
+
+			public:
+				~schema_t();
+				schema_t(const schema_t&) = delete;
+				schema_t& operator =(const schema_t&) = delete;
+
+				// source: the caller's key for what the schema was generated from
+				// (e.g. a hash of plugin manifests); load() treats a file with a
+				// different one as stale and returns nullptr, as for a missing,
+				// corrupt or other version file
+				static std::shared_ptr<const schema_t> compile(const usage_t& usage, uint64_t source = 0);
+				static std::shared_ptr<const schema_t> load(const std::string& path, uint64_t source = 0);
+				bool write(const std::string& path) const;
+
+				uint64_t hash() const;                // of the content
+				uint64_t source() const;
+
+				// help of the root, or of a command by its path; "" if there's none
+				std::string_view help(const std::vector<std::string>& command = {}) const;
+
+				std::shared_ptr<const parsed_t> parse(const std::vector<std::string>& args) const;
+
+				// as usage_t::suggest, from the options and commands of the root
+				// or of a command by its path
+				std::vector<std::string> suggest(const std::string& name, const std::vector<std::string>& command = {}) const;
+
+				// memory of a usage_t tree - its objects and the heap blocks behind
+				// their strings and vectors, estimated - against this image
+				struct footprint_t {
+					size_t usage_bytes = 0;
+					size_t usage_blocks = 0;              // separate heap allocations
+					size_t image_bytes = 0;
+					size_t pool_bytes = 0;                // interned strings, in the image
+				};
+
+				footprint_t footprint(const usage_t& usage) const;
+		};
+
+		// one module's share of a merged schema, see merge()
+		struct module_t {
+			std::string name;
+			std::vector<std::pair<std::string, option_t>> options;
+			std::vector<std::pair<std::string, std::shared_ptr<usage_t>>> commands;
+		};
+
+		// an entry merge() left out: it clashes with one declared before it
+		struct conflict_t {
+			std::string what;         // "name", "key", "word" or "command"
+			std::string value;        // the clashing name, key, word or command
+			std::string module;       // declared first by ("" - this usage_t's own)
+			std::string other;        // declared again by, and left out
+		};
+
 		struct info_t {
 			std::string name;
 			std::string version_title = "\nversion ";
@@ -120,6 +474,23 @@ class usage_t {
 			std::string footer;
 		};
 
+		#ifdef USAGE_STATS
+		// parse instrumentation, per thread. Only there when the library (and
+		// the program reading it) is built with -DUSAGE_STATS.
+		struct stats_t {
+			size_t tokens = 0;                   // arguments processed
+			size_t lookups = 0;                  // option table lookups
+			size_t allocations = 0;              // entries stored in values/errors/remainder/tail
+			size_t errors[4] = {};               // by error_type
+			std::chrono::nanoseconds parse{0};       // whole validator runs, subcommands included
+			std::chrono::nanoseconds validation{0};  // checking/converting option arguments
+			std::chrono::nanoseconds help{0};        // rendering help()
+			std::unordered_map<std::string, std::chrono::nanoseconds> dispatch;   // by subcommand
+		};
+
+		static stats_t& stats();                     // reset with stats() = {}
+		#endif
+
 		args_t args;
 		info_t info;
 
@@ -133,8 +504,39 @@ class usage_t {
 		// tail()). Empty -> no subcommand handling (the classic behaviour).
 		std::vector<std::pair<std::string, std::shared_ptr<usage_t>>> commands;
 
+		// optional typed positional slots, in order: the leading positional
+		// arguments (remainder()) are checked against them like option
+		// arguments and stored into values by slot name. Each slot is required;
+		// a variadic last slot takes all the rest, converted (see variadic()),
+		// in parallel when there are many. Empty -> positionals are unchecked.
+		// Not checked when a command is dispatched. A variadic slot before the
+		// last, or a slot named as an option, throws std::invalid_argument.
+		std::vector<positional_t> positionals;
+
 		validator_t validated = validator_t(this);
 
+		// what a usage_t works out from itself and keeps: each has its own, a
+		// copy starts without
+		template <typename T>
+		class own_ref_t {
+
+			public:
+				std::shared_ptr<T> ptr;
+
+				own_ref_t() = default;
+				own_ref_t(const own_ref_t&) {}
+				own_ref_t& operator =(const own_ref_t&) { return *this; }
+		};
+
+		mutable own_ref_t<help_cache_t> help_cache;            // rendered help by width and documents, see help(width), document()
+		mutable own_ref_t<const fallbacks_t> fallback_index;   // see fallbacks()
+
+		// the options that have a fallback, by name: built on first use and
+		// kept (merge() drops it)
+		std::shared_ptr<const fallbacks_t> fallbacks() const;
+
+		// an option's result: not enabled when it was not given, its value
+		// then being its fallback (if any)
 		result_t operator [](const std::string& name) const;
 		result_t operator [](const char* name) const;
 
@@ -146,17 +548,116 @@ class usage_t {
 		std::string version() const;
 		std::string help() const;
 
+		// help with descriptions word wrapped to fit width columns (0: not
+		// wrapped, as help()), measured in display width. Rendered once per
+		// width and kept (help() is rendered each time).
+		std::string help(size_t width) const;
+
+		// drops the help and documents kept for this usage_t, for when it is
+		// edited in place after they were rendered (merge() calls it). Each
+		// command has its own: call it on the one that changed.
+		void invalidate_help() const;
+
+		// columns of the terminal on fd (TIOCGWINSZ), else $COLUMNS, else 0
+		static size_t terminal_width(int fd = 1);
+
+		// help of a command by its path, as `prog <path..> --help` would print
+		// it; "" if there's no such command (or it is raw)
+		std::string help(const std::vector<std::string>& command, size_t width = 0) const;
+
+		// the commands tree below a command (all of it by default) as help
+		// text, a man page, Markdown or a JSON schema. Each command's part is
+		// rendered when first asked for and kept (see help_cache), so only
+		// the commands on the way are ever touched.
+		std::string document(doc_type type, const std::vector<std::string>& command = {}) const;
+
+		// hidden `prog __export <text|man|markdown|json> [command..]` entry
+		// point, for writing documentation at build time: exporting() tells it
+		// was invoked (nothing else is parsed then), document() renders it
+		bool exporting() const;
+		std::string document() const;
+
+		// the validated result - values, typed, the remainder, the subcommand
+		// chain and errors - for shell scripts, in place of getopt: "sh" gives
+		// assignments safe to eval (set -- for the remainder), "nul" NUL
+		// terminated records, "json" a JSON object; "" for another format.
+		// Shell variables that two options would share are left out and
+		// reported as errors. write_result() writes it to fd in one write.
+		std::string result(const std::string& format) const;
+		bool write_result(const std::string& format, int fd = 1) const;
+
+		// hidden `prog __parse <sh|nul|json> [args..]` entry point: scripting()
+		// tells it was invoked - args are parsed as usual - and format() names
+		// the format asked for
+		bool scripting() const;
+		std::string format() const;
+
+		// parses args against options/commands without storing anything (validated
+		// is left as is): options, positionals, commands and errors go to h as they
+		// are met. After a command, its own options follow; after a raw command,
+		// its arguments as positionals. Checked positional slots come as options
+		// by slot name, once a command's arguments are parsed, and then options
+		// not given that have a fallback, not enabled. Returns false if any
+		// errors were met.
+		bool parse(const args_t& args, const handler_t& h) const;
+
+		// parses arguments (program name not included) against options/commands
+		// into a result of their own, leaving this usage_t - validated and bound
+		// variables - untouched; safe to call concurrently on the same schema.
+		std::shared_ptr<const parsed_t> parse(const std::vector<std::string>& args) const;
+
 		std::unordered_map<std::string, std::string> values() const;
 		std::vector<usage_t::error_t> errors() const;
 		std::vector<std::string> remainder() const;
+		const variadic_t& variadic() const;         // empty if no variadic slot
+
+		// without building error_t's: how many errors, and the first (nullptr
+		// if none)
+		size_t error_count() const;
+		const error_ref_t* first_error() const;
 
 		// subcommands (see the `commands` member)
 		std::string subcommand() const;             // matched command name ("" if none)
 		usage_t* sub() const;                        // its usage_t (nullptr if raw / none)
 		std::vector<std::string> tail() const;       // raw arguments after the command
 
-		bool contains(const std::string& name) const;
-		std::string value(const std::string& name) const;
+		// the matched command's slice of the original argv, without copies:
+		// [0] is the command name, the raw arguments follow and it ends with
+		// argv's terminating nullptr - ready for execvp/posix_spawn. nullptr if
+		// no command matched or args was not built from argc/argv.
+		char* const* passthrough() const;
+
+		// appends the options and commands of modules, in order, in linear time.
+		// An option whose name, key or word is taken already - keys and words
+		// share one namespace, as `-v` and `--v` are the same - or a command
+		// whose name is, is left out and reported. Re-runs the validator.
+		std::vector<conflict_t> merge(const std::vector<module_t>& modules);
+
+		bool contains(const std::string& name) const;            // given
+		std::string value(const std::string& name) const;        // given, or its fallback
+
+		// "did you mean": closest option keys/words ("-k", "--word") and command
+		// names to a mistyped one, best first. Empty when nothing is close enough.
+		std::vector<std::string> suggest(const std::string& name) const;
+		std::vector<std::string> suggest(const error_t& e) const;   // an unknown option's; none for other errors
+
+		// errors as operator<< prints them, with "did you mean" for unknown
+		// options - worked out only as they are printed, from this usage_t
+		struct explained_t {
+			const usage_t& usage;
+			const std::vector<error_t>& errors;
+		};
+
+		explained_t explain(const std::vector<error_t>& errors) const;
+
+		// shell completion: a static "bash", "zsh" or "fish" script for the whole
+		// commands tree, and the hidden `prog __complete <words..>` entry point -
+		// completing() tells it was invoked (nothing else is parsed then) and
+		// complete() lists candidates for the last, partial, word.
+		std::string completion(const std::string& shell) const;
+		bool completing() const;
+		std::vector<std::string> complete() const;
+		std::vector<std::string> complete(const std::vector<std::string>& words) const;
 };
 
 std::ostream& operator <<(std::ostream& os, const usage_t::args_t& args);
@@ -164,3 +665,5 @@ std::ostream& operator <<(std::ostream& os, const usage_t& usage);
 std::ostream& operator <<(std::ostream& os, const usage_t* usage);
 std::ostream& operator <<(std::ostream& os, const std::vector<usage_t::error_t>& errors);
 std::ostream& operator <<(std::ostream& os, const std::vector<usage_t::error_t>* errors);
+std::ostream& operator <<(std::ostream& os, const usage_t::explained_t& errors);
+std::ostream& operator <<(std::ostream& os, const usage_t::schema_t::footprint_t& footprint);
@@ -23,7 +23,8 @@ int main(int argc, char **argv) {
 			{ "option", { .key = "op", .word = "opt", .desc = "option with 2 character short opt" }},
 			{ "short", { .key = "b", .desc = "only short option is available" }},
 			{ "help", { .key = "h", .word = "help", .desc = "usage help" }},
-			{ "version", { .key = "v", .word = "version", .desc = "show version" }}
+			{ "version", { .key = "v", .word = "version", .desc = "show version" }},
+			{ "completion", { .word = "completion", .desc = "print shell completion script", .flag = usage_t::REQUIRED, .name = "bash|zsh|fish" }}
 		},
 		// subcommands: each gets its OWN usage_t (own options); a null entry is
 		// a raw passthrough whose arguments are left unparsed (see tail()).
@@ -39,13 +40,41 @@ int main(int argc, char **argv) {
 		}
 	};
 
+	// hidden `example __complete <words..>`: answer completion candidates only
+	if ( usage.completing()) {
+
+		for ( const auto& c : usage.complete())
+			std::cout << c << "\n";
+		return 0;
+	}
+
+	// hidden `example __export <text|man|markdown|json> [command..]`: docs only
+	if ( usage.exporting()) {
+
+		std::cout << usage.document();
+		return 0;
+	}
+
+	// hidden `example __parse <sh|nul|json> [args..]`: the parse result only,
+	// for scripts - eval "$(example __parse sh "$@")"
+	if ( usage.scripting()) {
+
+		usage.write_result(usage.format());
+
+		// failed, if any command on the way failed
+		for ( const usage_t* u = &usage; u != nullptr; u = u -> sub())
+			if ( !u -> validated )
+				return 1;
+		return 0;
+	}
+
 	// --- subcommands: dispatched before the classic option demo below -------
 	if ( usage.subcommand() == "greet" ) {
 
 		usage_t& g = *usage.sub();   // greet's own parsed usage_t
 
 		if ( !g.validated ) {
-			std::cout << "greet: command-line errors:\n" << g.errors() << std::endl;
+			std::cout << "greet: command-line errors:\n" << g.explain(g.errors()) << std::endl;
 			return 1;
 		}
 
@@ -55,16 +84,17 @@ int main(int argc, char **argv) {
 
 	} else if ( usage.subcommand() == "raw" ) {
 
+		// straight from argv, e.g. for execvp("tool", usage.passthrough())
 		std::cout << "raw passthrough received:";
-		for ( const auto& s : usage.tail())
-			std::cout << " " << s;
+		for ( char* const* a = usage.passthrough() + 1; *a != nullptr; a++ )
+			std::cout << " " << *a;
 		std::cout << std::endl;
 		return 0;
 	}
 
 	if ( usage["help"] ) {
 
-		std::cout << usage << "\n" << usage.help() << "\n" << std::endl;
+		std::cout << usage << "\n" << usage.help(usage_t::terminal_width()) << "\n" << std::endl;
 		return 0;
 
 	} else if ( usage["version"] ) {
@@ -72,6 +102,11 @@ int main(int argc, char **argv) {
 		std::cout << usage.version() << std::endl;
 		return 0;
 
+	} else if ( usage["completion"] ) {
+
+		std::cout << usage.completion(usage["completion"].value);
+		return 0;
+
 	} else if ( usage.args.empty()) {
 
 		std::cout << usage << "\n\n" << usage.name() <<
@@ -85,7 +120,7 @@ int main(int argc, char **argv) {
 
 		auto errors = usage.errors();
 
-		std::cout << "command-line errors found:\n" << errors << std::endl;
+		std::cout << "command-line errors found:\n" << usage.explain(errors) << std::endl;
 
 		if ( auto it = std::find_if(errors.begin(), errors.end(),
 			[](usage_t::error_t e) {
@@ -116,6 +151,10 @@ int main(int argc, char **argv) {
 		for ( const auto &s : usage.remainder())
 			std::cout << " " << s;
 		std::cout << "\n" << std::endl;
+
+		// a leading positional that is not a command may be a mistyped one
+		if ( auto s = usage.suggest(usage.remainder().front()); !s.empty())
+			std::cout << usage.remainder().front() << ": did you mean " << s.front() << "?\n" << std::endl;
 	}
 
 	return 0;
@@ -0,0 +1,1090 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "usage.hpp"
+
+static size_t allocations = 0;
+
+// every form of new is counted: single and array, throwing and nothrow,
+// default and over-aligned
+static void* allocate(size_t n, size_t align = 0) {
+
+	allocations++;
+	n = n ? n : 1;
+
+	if ( align == 0 )
+		return std::malloc(n);
+
+	return std::aligned_alloc(align, ( n + align - 1 ) / align * align);
+}
+
+static void* allocate_or_throw(size_t n, size_t align = 0) {
+
+	if ( void* p = allocate(n, align))
+		return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t n) { return allocate_or_throw(n); }
+void* operator new[](size_t n) { return allocate_or_throw(n); }
+void* operator new(size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new(size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+
+// generated options: name, key, word, desc, flag, arg name, type
+static const struct {
+	const char *option, *key, *word, *desc;
+	usage_t::arg_flag flag;
+	const char* name;
+	usage_t::arg_type type;
+} specs[] = {
+	{ "option0", "o0", "option0", "generated option number 0", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option1", "o1", "option1", "generated option number 1", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option2", "o2", "option2", "generated option number 2", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option3", "o3", "option3", "generated option number 3", usage_t::NO, "", usage_t::STRING },
+	{ "option4", "o4", "option4", "generated option number 4", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option5", "o5", "option5", "generated option number 5", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option6", "o6", "option6", "generated option number 6", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option7", "o7", "option7", "generated option number 7", usage_t::NO, "", usage_t::STRING },
+	{ "option8", "o8", "option8", "generated option number 8", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option9", "o9", "option9", "generated option number 9", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option10", "o10", "option10", "generated option number 10", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option11", "o11", "option11", "generated option number 11", usage_t::NO, "", usage_t::STRING },
+	{ "option12", "o12", "option12", "generated option number 12", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option13", "o13", "option13", "generated option number 13", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option14", "o14", "option14", "generated option number 14", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option15", "o15", "option15", "generated option number 15", usage_t::NO, "", usage_t::STRING },
+	{ "option16", "o16", "option16", "generated option number 16", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option17", "o17", "option17", "generated option number 17", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option18", "o18", "option18", "generated option number 18", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option19", "o19", "option19", "generated option number 19", usage_t::NO, "", usage_t::STRING },
+	{ "option20", "o20", "option20", "generated option number 20", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option21", "o21", "option21", "generated option number 21", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option22", "o22", "option22", "generated option number 22", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option23", "o23", "option23", "generated option number 23", usage_t::NO, "", usage_t::STRING },
+	{ "option24", "o24", "option24", "generated option number 24", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option25", "o25", "option25", "generated option number 25", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option26", "o26", "option26", "generated option number 26", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option27", "o27", "option27", "generated option number 27", usage_t::NO, "", usage_t::STRING },
+	{ "option28", "o28", "option28", "generated option number 28", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option29", "o29", "option29", "generated option number 29", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option30", "o30", "option30", "generated option number 30", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option31", "o31", "option31", "generated option number 31", usage_t::NO, "", usage_t::STRING },
+	{ "option32", "o32", "option32", "generated option number 32", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option33", "o33", "option33", "generated option number 33", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option34", "o34", "option34", "generated option number 34", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option35", "o35", "option35", "generated option number 35", usage_t::NO, "", usage_t::STRING },
+	{ "option36", "o36", "option36", "generated option number 36", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option37", "o37", "option37", "generated option number 37", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option38", "o38", "option38", "generated option number 38", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option39", "o39", "option39", "generated option number 39", usage_t::NO, "", usage_t::STRING },
+	{ "option40", "o40", "option40", "generated option number 40", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option41", "o41", "option41", "generated option number 41", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option42", "o42", "option42", "generated option number 42", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option43", "o43", "option43", "generated option number 43", usage_t::NO, "", usage_t::STRING },
+	{ "option44", "o44", "option44", "generated option number 44", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option45", "o45", "option45", "generated option number 45", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option46", "o46", "option46", "generated option number 46", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option47", "o47", "option47", "generated option number 47", usage_t::NO, "", usage_t::STRING },
+	{ "option48", "o48", "option48", "generated option number 48", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option49", "o49", "option49", "generated option number 49", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option50", "o50", "option50", "generated option number 50", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option51", "o51", "option51", "generated option number 51", usage_t::NO, "", usage_t::STRING },
+	{ "option52", "o52", "option52", "generated option number 52", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option53", "o53", "option53", "generated option number 53", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option54", "o54", "option54", "generated option number 54", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option55", "o55", "option55", "generated option number 55", usage_t::NO, "", usage_t::STRING },
+	{ "option56", "o56", "option56", "generated option number 56", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option57", "o57", "option57", "generated option number 57", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option58", "o58", "option58", "generated option number 58", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option59", "o59", "option59", "generated option number 59", usage_t::NO, "", usage_t::STRING },
+	{ "option60", "o60", "option60", "generated option number 60", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option61", "o61", "option61", "generated option number 61", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option62", "o62", "option62", "generated option number 62", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option63", "o63", "option63", "generated option number 63", usage_t::NO, "", usage_t::STRING },
+	{ "option64", "o64", "option64", "generated option number 64", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option65", "o65", "option65", "generated option number 65", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option66", "o66", "option66", "generated option number 66", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option67", "o67", "option67", "generated option number 67", usage_t::NO, "", usage_t::STRING },
+	{ "option68", "o68", "option68", "generated option number 68", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option69", "o69", "option69", "generated option number 69", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option70", "o70", "option70", "generated option number 70", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option71", "o71", "option71", "generated option number 71", usage_t::NO, "", usage_t::STRING },
+	{ "option72", "o72", "option72", "generated option number 72", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option73", "o73", "option73", "generated option number 73", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option74", "o74", "option74", "generated option number 74", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option75", "o75", "option75", "generated option number 75", usage_t::NO, "", usage_t::STRING },
+	{ "option76", "o76", "option76", "generated option number 76", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option77", "o77", "option77", "generated option number 77", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option78", "o78", "option78", "generated option number 78", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option79", "o79", "option79", "generated option number 79", usage_t::NO, "", usage_t::STRING },
+	{ "option80", "o80", "option80", "generated option number 80", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option81", "o81", "option81", "generated option number 81", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option82", "o82", "option82", "generated option number 82", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option83", "o83", "option83", "generated option number 83", usage_t::NO, "", usage_t::STRING },
+	{ "option84", "o84", "option84", "generated option number 84", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option85", "o85", "option85", "generated option number 85", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option86", "o86", "option86", "generated option number 86", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option87", "o87", "option87", "generated option number 87", usage_t::NO, "", usage_t::STRING },
+	{ "option88", "o88", "option88", "generated option number 88", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option89", "o89", "option89", "generated option number 89", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option90", "o90", "option90", "generated option number 90", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option91", "o91", "option91", "generated option number 91", usage_t::NO, "", usage_t::STRING },
+	{ "option92", "o92", "option92", "generated option number 92", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option93", "o93", "option93", "generated option number 93", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option94", "o94", "option94", "generated option number 94", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option95", "o95", "option95", "generated option number 95", usage_t::NO, "", usage_t::STRING },
+	{ "option96", "o96", "option96", "generated option number 96", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option97", "o97", "option97", "generated option number 97", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option98", "o98", "option98", "generated option number 98", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option99", "o99", "option99", "generated option number 99", usage_t::NO, "", usage_t::STRING },
+	{ "option100", "o100", "option100", "generated option number 100", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option101", "o101", "option101", "generated option number 101", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option102", "o102", "option102", "generated option number 102", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option103", "o103", "option103", "generated option number 103", usage_t::NO, "", usage_t::STRING },
+	{ "option104", "o104", "option104", "generated option number 104", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option105", "o105", "option105", "generated option number 105", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option106", "o106", "option106", "generated option number 106", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option107", "o107", "option107", "generated option number 107", usage_t::NO, "", usage_t::STRING },
+	{ "option108", "o108", "option108", "generated option number 108", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option109", "o109", "option109", "generated option number 109", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option110", "o110", "option110", "generated option number 110", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option111", "o111", "option111", "generated option number 111", usage_t::NO, "", usage_t::STRING },
+	{ "option112", "o112", "option112", "generated option number 112", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option113", "o113", "option113", "generated option number 113", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option114", "o114", "option114", "generated option number 114", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option115", "o115", "option115", "generated option number 115", usage_t::NO, "", usage_t::STRING },
+	{ "option116", "o116", "option116", "generated option number 116", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option117", "o117", "option117", "generated option number 117", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option118", "o118", "option118", "generated option number 118", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option119", "o119", "option119", "generated option number 119", usage_t::NO, "", usage_t::STRING },
+	{ "option120", "o120", "option120", "generated option number 120", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option121", "o121", "option121", "generated option number 121", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option122", "o122", "option122", "generated option number 122", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option123", "o123", "option123", "generated option number 123", usage_t::NO, "", usage_t::STRING },
+	{ "option124", "o124", "option124", "generated option number 124", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option125", "o125", "option125", "generated option number 125", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option126", "o126", "option126", "generated option number 126", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option127", "o127", "option127", "generated option number 127", usage_t::NO, "", usage_t::STRING },
+	{ "option128", "o128", "option128", "generated option number 128", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option129", "o129", "option129", "generated option number 129", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option130", "o130", "option130", "generated option number 130", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option131", "o131", "option131", "generated option number 131", usage_t::NO, "", usage_t::STRING },
+	{ "option132", "o132", "option132", "generated option number 132", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option133", "o133", "option133", "generated option number 133", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option134", "o134", "option134", "generated option number 134", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option135", "o135", "option135", "generated option number 135", usage_t::NO, "", usage_t::STRING },
+	{ "option136", "o136", "option136", "generated option number 136", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option137", "o137", "option137", "generated option number 137", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option138", "o138", "option138", "generated option number 138", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option139", "o139", "option139", "generated option number 139", usage_t::NO, "", usage_t::STRING },
+	{ "option140", "o140", "option140", "generated option number 140", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option141", "o141", "option141", "generated option number 141", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option142", "o142", "option142", "generated option number 142", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option143", "o143", "option143", "generated option number 143", usage_t::NO, "", usage_t::STRING },
+	{ "option144", "o144", "option144", "generated option number 144", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option145", "o145", "option145", "generated option number 145", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option146", "o146", "option146", "generated option number 146", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option147", "o147", "option147", "generated option number 147", usage_t::NO, "", usage_t::STRING },
+	{ "option148", "o148", "option148", "generated option number 148", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option149", "o149", "option149", "generated option number 149", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option150", "o150", "option150", "generated option number 150", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option151", "o151", "option151", "generated option number 151", usage_t::NO, "", usage_t::STRING },
+	{ "option152", "o152", "option152", "generated option number 152", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option153", "o153", "option153", "generated option number 153", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option154", "o154", "option154", "generated option number 154", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option155", "o155", "option155", "generated option number 155", usage_t::NO, "", usage_t::STRING },
+	{ "option156", "o156", "option156", "generated option number 156", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option157", "o157", "option157", "generated option number 157", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option158", "o158", "option158", "generated option number 158", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option159", "o159", "option159", "generated option number 159", usage_t::NO, "", usage_t::STRING },
+	{ "option160", "o160", "option160", "generated option number 160", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option161", "o161", "option161", "generated option number 161", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option162", "o162", "option162", "generated option number 162", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option163", "o163", "option163", "generated option number 163", usage_t::NO, "", usage_t::STRING },
+	{ "option164", "o164", "option164", "generated option number 164", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option165", "o165", "option165", "generated option number 165", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option166", "o166", "option166", "generated option number 166", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option167", "o167", "option167", "generated option number 167", usage_t::NO, "", usage_t::STRING },
+	{ "option168", "o168", "option168", "generated option number 168", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option169", "o169", "option169", "generated option number 169", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option170", "o170", "option170", "generated option number 170", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option171", "o171", "option171", "generated option number 171", usage_t::NO, "", usage_t::STRING },
+	{ "option172", "o172", "option172", "generated option number 172", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option173", "o173", "option173", "generated option number 173", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option174", "o174", "option174", "generated option number 174", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option175", "o175", "option175", "generated option number 175", usage_t::NO, "", usage_t::STRING },
+	{ "option176", "o176", "option176", "generated option number 176", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option177", "o177", "option177", "generated option number 177", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option178", "o178", "option178", "generated option number 178", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option179", "o179", "option179", "generated option number 179", usage_t::NO, "", usage_t::STRING },
+	{ "option180", "o180", "option180", "generated option number 180", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option181", "o181", "option181", "generated option number 181", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option182", "o182", "option182", "generated option number 182", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option183", "o183", "option183", "generated option number 183", usage_t::NO, "", usage_t::STRING },
+	{ "option184", "o184", "option184", "generated option number 184", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option185", "o185", "option185", "generated option number 185", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option186", "o186", "option186", "generated option number 186", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option187", "o187", "option187", "generated option number 187", usage_t::NO, "", usage_t::STRING },
+	{ "option188", "o188", "option188", "generated option number 188", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option189", "o189", "option189", "generated option number 189", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option190", "o190", "option190", "generated option number 190", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option191", "o191", "option191", "generated option number 191", usage_t::NO, "", usage_t::STRING },
+	{ "option192", "o192", "option192", "generated option number 192", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option193", "o193", "option193", "generated option number 193", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option194", "o194", "option194", "generated option number 194", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option195", "o195", "option195", "generated option number 195", usage_t::NO, "", usage_t::STRING },
+	{ "option196", "o196", "option196", "generated option number 196", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option197", "o197", "option197", "generated option number 197", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option198", "o198", "option198", "generated option number 198", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option199", "o199", "option199", "generated option number 199", usage_t::NO, "", usage_t::STRING },
+	{ "option200", "o200", "option200", "generated option number 200", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option201", "o201", "option201", "generated option number 201", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option202", "o202", "option202", "generated option number 202", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option203", "o203", "option203", "generated option number 203", usage_t::NO, "", usage_t::STRING },
+	{ "option204", "o204", "option204", "generated option number 204", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option205", "o205", "option205", "generated option number 205", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option206", "o206", "option206", "generated option number 206", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option207", "o207", "option207", "generated option number 207", usage_t::NO, "", usage_t::STRING },
+	{ "option208", "o208", "option208", "generated option number 208", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option209", "o209", "option209", "generated option number 209", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option210", "o210", "option210", "generated option number 210", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option211", "o211", "option211", "generated option number 211", usage_t::NO, "", usage_t::STRING },
+	{ "option212", "o212", "option212", "generated option number 212", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option213", "o213", "option213", "generated option number 213", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option214", "o214", "option214", "generated option number 214", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option215", "o215", "option215", "generated option number 215", usage_t::NO, "", usage_t::STRING },
+	{ "option216", "o216", "option216", "generated option number 216", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option217", "o217", "option217", "generated option number 217", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option218", "o218", "option218", "generated option number 218", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option219", "o219", "option219", "generated option number 219", usage_t::NO, "", usage_t::STRING },
+	{ "option220", "o220", "option220", "generated option number 220", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option221", "o221", "option221", "generated option number 221", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option222", "o222", "option222", "generated option number 222", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option223", "o223", "option223", "generated option number 223", usage_t::NO, "", usage_t::STRING },
+	{ "option224", "o224", "option224", "generated option number 224", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option225", "o225", "option225", "generated option number 225", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option226", "o226", "option226", "generated option number 226", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option227", "o227", "option227", "generated option number 227", usage_t::NO, "", usage_t::STRING },
+	{ "option228", "o228", "option228", "generated option number 228", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option229", "o229", "option229", "generated option number 229", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option230", "o230", "option230", "generated option number 230", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option231", "o231", "option231", "generated option number 231", usage_t::NO, "", usage_t::STRING },
+	{ "option232", "o232", "option232", "generated option number 232", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option233", "o233", "option233", "generated option number 233", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option234", "o234", "option234", "generated option number 234", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option235", "o235", "option235", "generated option number 235", usage_t::NO, "", usage_t::STRING },
+	{ "option236", "o236", "option236", "generated option number 236", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option237", "o237", "option237", "generated option number 237", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option238", "o238", "option238", "generated option number 238", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option239", "o239", "option239", "generated option number 239", usage_t::NO, "", usage_t::STRING },
+	{ "option240", "o240", "option240", "generated option number 240", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option241", "o241", "option241", "generated option number 241", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option242", "o242", "option242", "generated option number 242", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option243", "o243", "option243", "generated option number 243", usage_t::NO, "", usage_t::STRING },
+	{ "option244", "o244", "option244", "generated option number 244", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option245", "o245", "option245", "generated option number 245", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option246", "o246", "option246", "generated option number 246", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option247", "o247", "option247", "generated option number 247", usage_t::NO, "", usage_t::STRING },
+	{ "option248", "o248", "option248", "generated option number 248", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option249", "o249", "option249", "generated option number 249", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option250", "o250", "option250", "generated option number 250", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option251", "o251", "option251", "generated option number 251", usage_t::NO, "", usage_t::STRING },
+	{ "option252", "o252", "option252", "generated option number 252", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option253", "o253", "option253", "generated option number 253", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option254", "o254", "option254", "generated option number 254", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option255", "o255", "option255", "generated option number 255", usage_t::NO, "", usage_t::STRING },
+	{ "option256", "o256", "option256", "generated option number 256", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option257", "o257", "option257", "generated option number 257", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option258", "o258", "option258", "generated option number 258", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option259", "o259", "option259", "generated option number 259", usage_t::NO, "", usage_t::STRING },
+	{ "option260", "o260", "option260", "generated option number 260", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option261", "o261", "option261", "generated option number 261", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option262", "o262", "option262", "generated option number 262", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option263", "o263", "option263", "generated option number 263", usage_t::NO, "", usage_t::STRING },
+	{ "option264", "o264", "option264", "generated option number 264", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option265", "o265", "option265", "generated option number 265", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option266", "o266", "option266", "generated option number 266", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option267", "o267", "option267", "generated option number 267", usage_t::NO, "", usage_t::STRING },
+	{ "option268", "o268", "option268", "generated option number 268", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option269", "o269", "option269", "generated option number 269", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option270", "o270", "option270", "generated option number 270", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option271", "o271", "option271", "generated option number 271", usage_t::NO, "", usage_t::STRING },
+	{ "option272", "o272", "option272", "generated option number 272", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option273", "o273", "option273", "generated option number 273", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option274", "o274", "option274", "generated option number 274", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option275", "o275", "option275", "generated option number 275", usage_t::NO, "", usage_t::STRING },
+	{ "option276", "o276", "option276", "generated option number 276", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option277", "o277", "option277", "generated option number 277", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option278", "o278", "option278", "generated option number 278", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option279", "o279", "option279", "generated option number 279", usage_t::NO, "", usage_t::STRING },
+	{ "option280", "o280", "option280", "generated option number 280", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option281", "o281", "option281", "generated option number 281", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option282", "o282", "option282", "generated option number 282", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option283", "o283", "option283", "generated option number 283", usage_t::NO, "", usage_t::STRING },
+	{ "option284", "o284", "option284", "generated option number 284", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option285", "o285", "option285", "generated option number 285", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option286", "o286", "option286", "generated option number 286", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option287", "o287", "option287", "generated option number 287", usage_t::NO, "", usage_t::STRING },
+	{ "option288", "o288", "option288", "generated option number 288", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option289", "o289", "option289", "generated option number 289", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option290", "o290", "option290", "generated option number 290", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option291", "o291", "option291", "generated option number 291", usage_t::NO, "", usage_t::STRING },
+	{ "option292", "o292", "option292", "generated option number 292", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option293", "o293", "option293", "generated option number 293", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option294", "o294", "option294", "generated option number 294", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option295", "o295", "option295", "generated option number 295", usage_t::NO, "", usage_t::STRING },
+	{ "option296", "o296", "option296", "generated option number 296", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option297", "o297", "option297", "generated option number 297", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option298", "o298", "option298", "generated option number 298", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option299", "o299", "option299", "generated option number 299", usage_t::NO, "", usage_t::STRING },
+	{ "option300", "o300", "option300", "generated option number 300", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option301", "o301", "option301", "generated option number 301", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option302", "o302", "option302", "generated option number 302", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option303", "o303", "option303", "generated option number 303", usage_t::NO, "", usage_t::STRING },
+	{ "option304", "o304", "option304", "generated option number 304", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option305", "o305", "option305", "generated option number 305", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option306", "o306", "option306", "generated option number 306", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option307", "o307", "option307", "generated option number 307", usage_t::NO, "", usage_t::STRING },
+	{ "option308", "o308", "option308", "generated option number 308", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option309", "o309", "option309", "generated option number 309", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option310", "o310", "option310", "generated option number 310", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option311", "o311", "option311", "generated option number 311", usage_t::NO, "", usage_t::STRING },
+	{ "option312", "o312", "option312", "generated option number 312", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option313", "o313", "option313", "generated option number 313", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option314", "o314", "option314", "generated option number 314", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option315", "o315", "option315", "generated option number 315", usage_t::NO, "", usage_t::STRING },
+	{ "option316", "o316", "option316", "generated option number 316", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option317", "o317", "option317", "generated option number 317", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option318", "o318", "option318", "generated option number 318", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option319", "o319", "option319", "generated option number 319", usage_t::NO, "", usage_t::STRING },
+	{ "option320", "o320", "option320", "generated option number 320", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option321", "o321", "option321", "generated option number 321", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option322", "o322", "option322", "generated option number 322", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option323", "o323", "option323", "generated option number 323", usage_t::NO, "", usage_t::STRING },
+	{ "option324", "o324", "option324", "generated option number 324", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option325", "o325", "option325", "generated option number 325", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option326", "o326", "option326", "generated option number 326", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option327", "o327", "option327", "generated option number 327", usage_t::NO, "", usage_t::STRING },
+	{ "option328", "o328", "option328", "generated option number 328", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option329", "o329", "option329", "generated option number 329", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option330", "o330", "option330", "generated option number 330", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option331", "o331", "option331", "generated option number 331", usage_t::NO, "", usage_t::STRING },
+	{ "option332", "o332", "option332", "generated option number 332", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option333", "o333", "option333", "generated option number 333", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option334", "o334", "option334", "generated option number 334", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option335", "o335", "option335", "generated option number 335", usage_t::NO, "", usage_t::STRING },
+	{ "option336", "o336", "option336", "generated option number 336", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option337", "o337", "option337", "generated option number 337", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option338", "o338", "option338", "generated option number 338", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option339", "o339", "option339", "generated option number 339", usage_t::NO, "", usage_t::STRING },
+	{ "option340", "o340", "option340", "generated option number 340", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option341", "o341", "option341", "generated option number 341", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option342", "o342", "option342", "generated option number 342", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option343", "o343", "option343", "generated option number 343", usage_t::NO, "", usage_t::STRING },
+	{ "option344", "o344", "option344", "generated option number 344", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option345", "o345", "option345", "generated option number 345", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option346", "o346", "option346", "generated option number 346", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option347", "o347", "option347", "generated option number 347", usage_t::NO, "", usage_t::STRING },
+	{ "option348", "o348", "option348", "generated option number 348", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option349", "o349", "option349", "generated option number 349", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option350", "o350", "option350", "generated option number 350", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option351", "o351", "option351", "generated option number 351", usage_t::NO, "", usage_t::STRING },
+	{ "option352", "o352", "option352", "generated option number 352", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option353", "o353", "option353", "generated option number 353", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option354", "o354", "option354", "generated option number 354", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option355", "o355", "option355", "generated option number 355", usage_t::NO, "", usage_t::STRING },
+	{ "option356", "o356", "option356", "generated option number 356", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option357", "o357", "option357", "generated option number 357", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option358", "o358", "option358", "generated option number 358", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option359", "o359", "option359", "generated option number 359", usage_t::NO, "", usage_t::STRING },
+	{ "option360", "o360", "option360", "generated option number 360", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option361", "o361", "option361", "generated option number 361", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option362", "o362", "option362", "generated option number 362", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option363", "o363", "option363", "generated option number 363", usage_t::NO, "", usage_t::STRING },
+	{ "option364", "o364", "option364", "generated option number 364", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option365", "o365", "option365", "generated option number 365", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option366", "o366", "option366", "generated option number 366", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option367", "o367", "option367", "generated option number 367", usage_t::NO, "", usage_t::STRING },
+	{ "option368", "o368", "option368", "generated option number 368", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option369", "o369", "option369", "generated option number 369", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option370", "o370", "option370", "generated option number 370", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option371", "o371", "option371", "generated option number 371", usage_t::NO, "", usage_t::STRING },
+	{ "option372", "o372", "option372", "generated option number 372", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option373", "o373", "option373", "generated option number 373", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option374", "o374", "option374", "generated option number 374", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option375", "o375", "option375", "generated option number 375", usage_t::NO, "", usage_t::STRING },
+	{ "option376", "o376", "option376", "generated option number 376", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option377", "o377", "option377", "generated option number 377", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option378", "o378", "option378", "generated option number 378", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option379", "o379", "option379", "generated option number 379", usage_t::NO, "", usage_t::STRING },
+	{ "option380", "o380", "option380", "generated option number 380", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option381", "o381", "option381", "generated option number 381", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option382", "o382", "option382", "generated option number 382", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option383", "o383", "option383", "generated option number 383", usage_t::NO, "", usage_t::STRING },
+	{ "option384", "o384", "option384", "generated option number 384", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option385", "o385", "option385", "generated option number 385", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option386", "o386", "option386", "generated option number 386", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option387", "o387", "option387", "generated option number 387", usage_t::NO, "", usage_t::STRING },
+	{ "option388", "o388", "option388", "generated option number 388", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option389", "o389", "option389", "generated option number 389", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option390", "o390", "option390", "generated option number 390", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option391", "o391", "option391", "generated option number 391", usage_t::NO, "", usage_t::STRING },
+	{ "option392", "o392", "option392", "generated option number 392", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option393", "o393", "option393", "generated option number 393", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option394", "o394", "option394", "generated option number 394", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option395", "o395", "option395", "generated option number 395", usage_t::NO, "", usage_t::STRING },
+	{ "option396", "o396", "option396", "generated option number 396", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option397", "o397", "option397", "generated option number 397", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option398", "o398", "option398", "generated option number 398", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option399", "o399", "option399", "generated option number 399", usage_t::NO, "", usage_t::STRING },
+	{ "option400", "o400", "option400", "generated option number 400", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option401", "o401", "option401", "generated option number 401", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option402", "o402", "option402", "generated option number 402", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option403", "o403", "option403", "generated option number 403", usage_t::NO, "", usage_t::STRING },
+	{ "option404", "o404", "option404", "generated option number 404", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option405", "o405", "option405", "generated option number 405", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option406", "o406", "option406", "generated option number 406", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option407", "o407", "option407", "generated option number 407", usage_t::NO, "", usage_t::STRING },
+	{ "option408", "o408", "option408", "generated option number 408", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option409", "o409", "option409", "generated option number 409", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option410", "o410", "option410", "generated option number 410", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option411", "o411", "option411", "generated option number 411", usage_t::NO, "", usage_t::STRING },
+	{ "option412", "o412", "option412", "generated option number 412", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option413", "o413", "option413", "generated option number 413", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option414", "o414", "option414", "generated option number 414", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option415", "o415", "option415", "generated option number 415", usage_t::NO, "", usage_t::STRING },
+	{ "option416", "o416", "option416", "generated option number 416", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option417", "o417", "option417", "generated option number 417", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option418", "o418", "option418", "generated option number 418", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option419", "o419", "option419", "generated option number 419", usage_t::NO, "", usage_t::STRING },
+	{ "option420", "o420", "option420", "generated option number 420", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option421", "o421", "option421", "generated option number 421", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option422", "o422", "option422", "generated option number 422", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option423", "o423", "option423", "generated option number 423", usage_t::NO, "", usage_t::STRING },
+	{ "option424", "o424", "option424", "generated option number 424", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option425", "o425", "option425", "generated option number 425", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option426", "o426", "option426", "generated option number 426", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option427", "o427", "option427", "generated option number 427", usage_t::NO, "", usage_t::STRING },
+	{ "option428", "o428", "option428", "generated option number 428", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option429", "o429", "option429", "generated option number 429", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option430", "o430", "option430", "generated option number 430", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option431", "o431", "option431", "generated option number 431", usage_t::NO, "", usage_t::STRING },
+	{ "option432", "o432", "option432", "generated option number 432", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option433", "o433", "option433", "generated option number 433", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option434", "o434", "option434", "generated option number 434", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option435", "o435", "option435", "generated option number 435", usage_t::NO, "", usage_t::STRING },
+	{ "option436", "o436", "option436", "generated option number 436", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option437", "o437", "option437", "generated option number 437", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option438", "o438", "option438", "generated option number 438", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option439", "o439", "option439", "generated option number 439", usage_t::NO, "", usage_t::STRING },
+	{ "option440", "o440", "option440", "generated option number 440", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option441", "o441", "option441", "generated option number 441", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option442", "o442", "option442", "generated option number 442", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option443", "o443", "option443", "generated option number 443", usage_t::NO, "", usage_t::STRING },
+	{ "option444", "o444", "option444", "generated option number 444", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option445", "o445", "option445", "generated option number 445", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option446", "o446", "option446", "generated option number 446", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option447", "o447", "option447", "generated option number 447", usage_t::NO, "", usage_t::STRING },
+	{ "option448", "o448", "option448", "generated option number 448", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option449", "o449", "option449", "generated option number 449", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option450", "o450", "option450", "generated option number 450", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option451", "o451", "option451", "generated option number 451", usage_t::NO, "", usage_t::STRING },
+	{ "option452", "o452", "option452", "generated option number 452", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option453", "o453", "option453", "generated option number 453", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option454", "o454", "option454", "generated option number 454", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option455", "o455", "option455", "generated option number 455", usage_t::NO, "", usage_t::STRING },
+	{ "option456", "o456", "option456", "generated option number 456", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option457", "o457", "option457", "generated option number 457", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option458", "o458", "option458", "generated option number 458", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option459", "o459", "option459", "generated option number 459", usage_t::NO, "", usage_t::STRING },
+	{ "option460", "o460", "option460", "generated option number 460", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option461", "o461", "option461", "generated option number 461", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option462", "o462", "option462", "generated option number 462", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option463", "o463", "option463", "generated option number 463", usage_t::NO, "", usage_t::STRING },
+	{ "option464", "o464", "option464", "generated option number 464", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option465", "o465", "option465", "generated option number 465", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option466", "o466", "option466", "generated option number 466", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option467", "o467", "option467", "generated option number 467", usage_t::NO, "", usage_t::STRING },
+	{ "option468", "o468", "option468", "generated option number 468", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option469", "o469", "option469", "generated option number 469", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option470", "o470", "option470", "generated option number 470", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option471", "o471", "option471", "generated option number 471", usage_t::NO, "", usage_t::STRING },
+	{ "option472", "o472", "option472", "generated option number 472", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option473", "o473", "option473", "generated option number 473", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option474", "o474", "option474", "generated option number 474", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option475", "o475", "option475", "generated option number 475", usage_t::NO, "", usage_t::STRING },
+	{ "option476", "o476", "option476", "generated option number 476", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option477", "o477", "option477", "generated option number 477", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option478", "o478", "option478", "generated option number 478", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option479", "o479", "option479", "generated option number 479", usage_t::NO, "", usage_t::STRING },
+	{ "option480", "o480", "option480", "generated option number 480", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option481", "o481", "option481", "generated option number 481", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option482", "o482", "option482", "generated option number 482", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option483", "o483", "option483", "generated option number 483", usage_t::NO, "", usage_t::STRING },
+	{ "option484", "o484", "option484", "generated option number 484", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option485", "o485", "option485", "generated option number 485", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option486", "o486", "option486", "generated option number 486", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option487", "o487", "option487", "generated option number 487", usage_t::NO, "", usage_t::STRING },
+	{ "option488", "o488", "option488", "generated option number 488", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option489", "o489", "option489", "generated option number 489", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option490", "o490", "option490", "generated option number 490", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option491", "o491", "option491", "generated option number 491", usage_t::NO, "", usage_t::STRING },
+	{ "option492", "o492", "option492", "generated option number 492", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option493", "o493", "option493", "generated option number 493", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option494", "o494", "option494", "generated option number 494", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option495", "o495", "option495", "generated option number 495", usage_t::NO, "", usage_t::STRING },
+	{ "option496", "o496", "option496", "generated option number 496", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option497", "o497", "option497", "generated option number 497", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option498", "o498", "option498", "generated option number 498", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option499", "o499", "option499", "generated option number 499", usage_t::NO, "", usage_t::STRING },
+	{ "option500", "o500", "option500", "generated option number 500", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option501", "o501", "option501", "generated option number 501", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option502", "o502", "option502", "generated option number 502", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option503", "o503", "option503", "generated option number 503", usage_t::NO, "", usage_t::STRING },
+	{ "option504", "o504", "option504", "generated option number 504", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option505", "o505", "option505", "generated option number 505", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option506", "o506", "option506", "generated option number 506", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option507", "o507", "option507", "generated option number 507", usage_t::NO, "", usage_t::STRING },
+	{ "option508", "o508", "option508", "generated option number 508", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option509", "o509", "option509", "generated option number 509", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option510", "o510", "option510", "generated option number 510", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option511", "o511", "option511", "generated option number 511", usage_t::NO, "", usage_t::STRING },
+	{ "option512", "o512", "option512", "generated option number 512", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option513", "o513", "option513", "generated option number 513", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option514", "o514", "option514", "generated option number 514", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option515", "o515", "option515", "generated option number 515", usage_t::NO, "", usage_t::STRING },
+	{ "option516", "o516", "option516", "generated option number 516", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option517", "o517", "option517", "generated option number 517", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option518", "o518", "option518", "generated option number 518", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option519", "o519", "option519", "generated option number 519", usage_t::NO, "", usage_t::STRING },
+	{ "option520", "o520", "option520", "generated option number 520", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option521", "o521", "option521", "generated option number 521", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option522", "o522", "option522", "generated option number 522", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option523", "o523", "option523", "generated option number 523", usage_t::NO, "", usage_t::STRING },
+	{ "option524", "o524", "option524", "generated option number 524", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option525", "o525", "option525", "generated option number 525", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option526", "o526", "option526", "generated option number 526", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option527", "o527", "option527", "generated option number 527", usage_t::NO, "", usage_t::STRING },
+	{ "option528", "o528", "option528", "generated option number 528", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option529", "o529", "option529", "generated option number 529", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option530", "o530", "option530", "generated option number 530", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option531", "o531", "option531", "generated option number 531", usage_t::NO, "", usage_t::STRING },
+	{ "option532", "o532", "option532", "generated option number 532", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option533", "o533", "option533", "generated option number 533", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option534", "o534", "option534", "generated option number 534", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option535", "o535", "option535", "generated option number 535", usage_t::NO, "", usage_t::STRING },
+	{ "option536", "o536", "option536", "generated option number 536", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option537", "o537", "option537", "generated option number 537", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option538", "o538", "option538", "generated option number 538", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option539", "o539", "option539", "generated option number 539", usage_t::NO, "", usage_t::STRING },
+	{ "option540", "o540", "option540", "generated option number 540", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option541", "o541", "option541", "generated option number 541", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option542", "o542", "option542", "generated option number 542", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option543", "o543", "option543", "generated option number 543", usage_t::NO, "", usage_t::STRING },
+	{ "option544", "o544", "option544", "generated option number 544", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option545", "o545", "option545", "generated option number 545", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option546", "o546", "option546", "generated option number 546", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option547", "o547", "option547", "generated option number 547", usage_t::NO, "", usage_t::STRING },
+	{ "option548", "o548", "option548", "generated option number 548", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option549", "o549", "option549", "generated option number 549", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option550", "o550", "option550", "generated option number 550", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option551", "o551", "option551", "generated option number 551", usage_t::NO, "", usage_t::STRING },
+	{ "option552", "o552", "option552", "generated option number 552", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option553", "o553", "option553", "generated option number 553", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option554", "o554", "option554", "generated option number 554", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option555", "o555", "option555", "generated option number 555", usage_t::NO, "", usage_t::STRING },
+	{ "option556", "o556", "option556", "generated option number 556", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option557", "o557", "option557", "generated option number 557", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option558", "o558", "option558", "generated option number 558", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option559", "o559", "option559", "generated option number 559", usage_t::NO, "", usage_t::STRING },
+	{ "option560", "o560", "option560", "generated option number 560", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option561", "o561", "option561", "generated option number 561", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option562", "o562", "option562", "generated option number 562", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option563", "o563", "option563", "generated option number 563", usage_t::NO, "", usage_t::STRING },
+	{ "option564", "o564", "option564", "generated option number 564", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option565", "o565", "option565", "generated option number 565", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option566", "o566", "option566", "generated option number 566", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option567", "o567", "option567", "generated option number 567", usage_t::NO, "", usage_t::STRING },
+	{ "option568", "o568", "option568", "generated option number 568", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option569", "o569", "option569", "generated option number 569", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option570", "o570", "option570", "generated option number 570", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option571", "o571", "option571", "generated option number 571", usage_t::NO, "", usage_t::STRING },
+	{ "option572", "o572", "option572", "generated option number 572", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option573", "o573", "option573", "generated option number 573", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option574", "o574", "option574", "generated option number 574", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option575", "o575", "option575", "generated option number 575", usage_t::NO, "", usage_t::STRING },
+	{ "option576", "o576", "option576", "generated option number 576", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option577", "o577", "option577", "generated option number 577", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option578", "o578", "option578", "generated option number 578", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option579", "o579", "option579", "generated option number 579", usage_t::NO, "", usage_t::STRING },
+	{ "option580", "o580", "option580", "generated option number 580", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option581", "o581", "option581", "generated option number 581", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option582", "o582", "option582", "generated option number 582", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option583", "o583", "option583", "generated option number 583", usage_t::NO, "", usage_t::STRING },
+	{ "option584", "o584", "option584", "generated option number 584", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option585", "o585", "option585", "generated option number 585", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option586", "o586", "option586", "generated option number 586", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option587", "o587", "option587", "generated option number 587", usage_t::NO, "", usage_t::STRING },
+	{ "option588", "o588", "option588", "generated option number 588", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option589", "o589", "option589", "generated option number 589", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option590", "o590", "option590", "generated option number 590", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option591", "o591", "option591", "generated option number 591", usage_t::NO, "", usage_t::STRING },
+	{ "option592", "o592", "option592", "generated option number 592", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option593", "o593", "option593", "generated option number 593", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option594", "o594", "option594", "generated option number 594", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option595", "o595", "option595", "generated option number 595", usage_t::NO, "", usage_t::STRING },
+	{ "option596", "o596", "option596", "generated option number 596", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option597", "o597", "option597", "generated option number 597", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option598", "o598", "option598", "generated option number 598", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option599", "o599", "option599", "generated option number 599", usage_t::NO, "", usage_t::STRING },
+	{ "option600", "o600", "option600", "generated option number 600", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option601", "o601", "option601", "generated option number 601", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option602", "o602", "option602", "generated option number 602", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option603", "o603", "option603", "generated option number 603", usage_t::NO, "", usage_t::STRING },
+	{ "option604", "o604", "option604", "generated option number 604", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option605", "o605", "option605", "generated option number 605", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option606", "o606", "option606", "generated option number 606", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option607", "o607", "option607", "generated option number 607", usage_t::NO, "", usage_t::STRING },
+	{ "option608", "o608", "option608", "generated option number 608", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option609", "o609", "option609", "generated option number 609", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option610", "o610", "option610", "generated option number 610", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option611", "o611", "option611", "generated option number 611", usage_t::NO, "", usage_t::STRING },
+	{ "option612", "o612", "option612", "generated option number 612", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option613", "o613", "option613", "generated option number 613", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option614", "o614", "option614", "generated option number 614", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option615", "o615", "option615", "generated option number 615", usage_t::NO, "", usage_t::STRING },
+	{ "option616", "o616", "option616", "generated option number 616", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option617", "o617", "option617", "generated option number 617", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option618", "o618", "option618", "generated option number 618", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option619", "o619", "option619", "generated option number 619", usage_t::NO, "", usage_t::STRING },
+	{ "option620", "o620", "option620", "generated option number 620", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option621", "o621", "option621", "generated option number 621", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option622", "o622", "option622", "generated option number 622", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option623", "o623", "option623", "generated option number 623", usage_t::NO, "", usage_t::STRING },
+	{ "option624", "o624", "option624", "generated option number 624", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option625", "o625", "option625", "generated option number 625", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option626", "o626", "option626", "generated option number 626", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option627", "o627", "option627", "generated option number 627", usage_t::NO, "", usage_t::STRING },
+	{ "option628", "o628", "option628", "generated option number 628", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option629", "o629", "option629", "generated option number 629", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option630", "o630", "option630", "generated option number 630", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option631", "o631", "option631", "generated option number 631", usage_t::NO, "", usage_t::STRING },
+	{ "option632", "o632", "option632", "generated option number 632", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option633", "o633", "option633", "generated option number 633", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option634", "o634", "option634", "generated option number 634", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option635", "o635", "option635", "generated option number 635", usage_t::NO, "", usage_t::STRING },
+	{ "option636", "o636", "option636", "generated option number 636", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option637", "o637", "option637", "generated option number 637", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option638", "o638", "option638", "generated option number 638", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option639", "o639", "option639", "generated option number 639", usage_t::NO, "", usage_t::STRING },
+	{ "option640", "o640", "option640", "generated option number 640", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option641", "o641", "option641", "generated option number 641", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option642", "o642", "option642", "generated option number 642", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option643", "o643", "option643", "generated option number 643", usage_t::NO, "", usage_t::STRING },
+	{ "option644", "o644", "option644", "generated option number 644", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option645", "o645", "option645", "generated option number 645", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option646", "o646", "option646", "generated option number 646", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option647", "o647", "option647", "generated option number 647", usage_t::NO, "", usage_t::STRING },
+	{ "option648", "o648", "option648", "generated option number 648", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option649", "o649", "option649", "generated option number 649", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option650", "o650", "option650", "generated option number 650", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option651", "o651", "option651", "generated option number 651", usage_t::NO, "", usage_t::STRING },
+	{ "option652", "o652", "option652", "generated option number 652", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option653", "o653", "option653", "generated option number 653", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option654", "o654", "option654", "generated option number 654", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option655", "o655", "option655", "generated option number 655", usage_t::NO, "", usage_t::STRING },
+	{ "option656", "o656", "option656", "generated option number 656", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option657", "o657", "option657", "generated option number 657", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option658", "o658", "option658", "generated option number 658", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option659", "o659", "option659", "generated option number 659", usage_t::NO, "", usage_t::STRING },
+	{ "option660", "o660", "option660", "generated option number 660", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option661", "o661", "option661", "generated option number 661", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option662", "o662", "option662", "generated option number 662", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option663", "o663", "option663", "generated option number 663", usage_t::NO, "", usage_t::STRING },
+	{ "option664", "o664", "option664", "generated option number 664", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option665", "o665", "option665", "generated option number 665", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option666", "o666", "option666", "generated option number 666", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option667", "o667", "option667", "generated option number 667", usage_t::NO, "", usage_t::STRING },
+	{ "option668", "o668", "option668", "generated option number 668", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option669", "o669", "option669", "generated option number 669", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option670", "o670", "option670", "generated option number 670", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option671", "o671", "option671", "generated option number 671", usage_t::NO, "", usage_t::STRING },
+	{ "option672", "o672", "option672", "generated option number 672", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option673", "o673", "option673", "generated option number 673", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option674", "o674", "option674", "generated option number 674", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option675", "o675", "option675", "generated option number 675", usage_t::NO, "", usage_t::STRING },
+	{ "option676", "o676", "option676", "generated option number 676", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option677", "o677", "option677", "generated option number 677", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option678", "o678", "option678", "generated option number 678", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option679", "o679", "option679", "generated option number 679", usage_t::NO, "", usage_t::STRING },
+	{ "option680", "o680", "option680", "generated option number 680", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option681", "o681", "option681", "generated option number 681", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option682", "o682", "option682", "generated option number 682", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option683", "o683", "option683", "generated option number 683", usage_t::NO, "", usage_t::STRING },
+	{ "option684", "o684", "option684", "generated option number 684", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option685", "o685", "option685", "generated option number 685", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option686", "o686", "option686", "generated option number 686", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option687", "o687", "option687", "generated option number 687", usage_t::NO, "", usage_t::STRING },
+	{ "option688", "o688", "option688", "generated option number 688", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option689", "o689", "option689", "generated option number 689", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option690", "o690", "option690", "generated option number 690", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option691", "o691", "option691", "generated option number 691", usage_t::NO, "", usage_t::STRING },
+	{ "option692", "o692", "option692", "generated option number 692", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option693", "o693", "option693", "generated option number 693", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option694", "o694", "option694", "generated option number 694", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option695", "o695", "option695", "generated option number 695", usage_t::NO, "", usage_t::STRING },
+	{ "option696", "o696", "option696", "generated option number 696", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option697", "o697", "option697", "generated option number 697", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option698", "o698", "option698", "generated option number 698", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option699", "o699", "option699", "generated option number 699", usage_t::NO, "", usage_t::STRING },
+	{ "option700", "o700", "option700", "generated option number 700", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option701", "o701", "option701", "generated option number 701", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option702", "o702", "option702", "generated option number 702", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option703", "o703", "option703", "generated option number 703", usage_t::NO, "", usage_t::STRING },
+	{ "option704", "o704", "option704", "generated option number 704", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option705", "o705", "option705", "generated option number 705", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option706", "o706", "option706", "generated option number 706", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option707", "o707", "option707", "generated option number 707", usage_t::NO, "", usage_t::STRING },
+	{ "option708", "o708", "option708", "generated option number 708", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option709", "o709", "option709", "generated option number 709", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option710", "o710", "option710", "generated option number 710", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option711", "o711", "option711", "generated option number 711", usage_t::NO, "", usage_t::STRING },
+	{ "option712", "o712", "option712", "generated option number 712", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option713", "o713", "option713", "generated option number 713", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option714", "o714", "option714", "generated option number 714", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option715", "o715", "option715", "generated option number 715", usage_t::NO, "", usage_t::STRING },
+	{ "option716", "o716", "option716", "generated option number 716", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option717", "o717", "option717", "generated option number 717", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option718", "o718", "option718", "generated option number 718", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option719", "o719", "option719", "generated option number 719", usage_t::NO, "", usage_t::STRING },
+	{ "option720", "o720", "option720", "generated option number 720", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option721", "o721", "option721", "generated option number 721", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option722", "o722", "option722", "generated option number 722", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option723", "o723", "option723", "generated option number 723", usage_t::NO, "", usage_t::STRING },
+	{ "option724", "o724", "option724", "generated option number 724", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option725", "o725", "option725", "generated option number 725", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option726", "o726", "option726", "generated option number 726", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option727", "o727", "option727", "generated option number 727", usage_t::NO, "", usage_t::STRING },
+	{ "option728", "o728", "option728", "generated option number 728", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option729", "o729", "option729", "generated option number 729", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option730", "o730", "option730", "generated option number 730", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option731", "o731", "option731", "generated option number 731", usage_t::NO, "", usage_t::STRING },
+	{ "option732", "o732", "option732", "generated option number 732", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option733", "o733", "option733", "generated option number 733", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option734", "o734", "option734", "generated option number 734", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option735", "o735", "option735", "generated option number 735", usage_t::NO, "", usage_t::STRING },
+	{ "option736", "o736", "option736", "generated option number 736", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option737", "o737", "option737", "generated option number 737", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option738", "o738", "option738", "generated option number 738", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option739", "o739", "option739", "generated option number 739", usage_t::NO, "", usage_t::STRING },
+	{ "option740", "o740", "option740", "generated option number 740", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option741", "o741", "option741", "generated option number 741", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option742", "o742", "option742", "generated option number 742", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option743", "o743", "option743", "generated option number 743", usage_t::NO, "", usage_t::STRING },
+	{ "option744", "o744", "option744", "generated option number 744", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option745", "o745", "option745", "generated option number 745", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option746", "o746", "option746", "generated option number 746", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option747", "o747", "option747", "generated option number 747", usage_t::NO, "", usage_t::STRING },
+	{ "option748", "o748", "option748", "generated option number 748", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option749", "o749", "option749", "generated option number 749", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option750", "o750", "option750", "generated option number 750", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option751", "o751", "option751", "generated option number 751", usage_t::NO, "", usage_t::STRING },
+	{ "option752", "o752", "option752", "generated option number 752", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option753", "o753", "option753", "generated option number 753", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option754", "o754", "option754", "generated option number 754", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option755", "o755", "option755", "generated option number 755", usage_t::NO, "", usage_t::STRING },
+	{ "option756", "o756", "option756", "generated option number 756", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option757", "o757", "option757", "generated option number 757", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option758", "o758", "option758", "generated option number 758", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option759", "o759", "option759", "generated option number 759", usage_t::NO, "", usage_t::STRING },
+	{ "option760", "o760", "option760", "generated option number 760", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option761", "o761", "option761", "generated option number 761", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option762", "o762", "option762", "generated option number 762", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option763", "o763", "option763", "generated option number 763", usage_t::NO, "", usage_t::STRING },
+	{ "option764", "o764", "option764", "generated option number 764", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option765", "o765", "option765", "generated option number 765", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option766", "o766", "option766", "generated option number 766", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option767", "o767", "option767", "generated option number 767", usage_t::NO, "", usage_t::STRING },
+	{ "option768", "o768", "option768", "generated option number 768", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option769", "o769", "option769", "generated option number 769", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option770", "o770", "option770", "generated option number 770", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option771", "o771", "option771", "generated option number 771", usage_t::NO, "", usage_t::STRING },
+	{ "option772", "o772", "option772", "generated option number 772", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option773", "o773", "option773", "generated option number 773", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option774", "o774", "option774", "generated option number 774", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option775", "o775", "option775", "generated option number 775", usage_t::NO, "", usage_t::STRING },
+	{ "option776", "o776", "option776", "generated option number 776", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option777", "o777", "option777", "generated option number 777", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option778", "o778", "option778", "generated option number 778", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option779", "o779", "option779", "generated option number 779", usage_t::NO, "", usage_t::STRING },
+	{ "option780", "o780", "option780", "generated option number 780", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option781", "o781", "option781", "generated option number 781", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option782", "o782", "option782", "generated option number 782", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option783", "o783", "option783", "generated option number 783", usage_t::NO, "", usage_t::STRING },
+	{ "option784", "o784", "option784", "generated option number 784", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option785", "o785", "option785", "generated option number 785", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option786", "o786", "option786", "generated option number 786", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option787", "o787", "option787", "generated option number 787", usage_t::NO, "", usage_t::STRING },
+	{ "option788", "o788", "option788", "generated option number 788", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option789", "o789", "option789", "generated option number 789", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option790", "o790", "option790", "generated option number 790", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option791", "o791", "option791", "generated option number 791", usage_t::NO, "", usage_t::STRING },
+	{ "option792", "o792", "option792", "generated option number 792", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option793", "o793", "option793", "generated option number 793", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option794", "o794", "option794", "generated option number 794", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option795", "o795", "option795", "generated option number 795", usage_t::NO, "", usage_t::STRING },
+	{ "option796", "o796", "option796", "generated option number 796", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option797", "o797", "option797", "generated option number 797", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option798", "o798", "option798", "generated option number 798", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option799", "o799", "option799", "generated option number 799", usage_t::NO, "", usage_t::STRING },
+	{ "option800", "o800", "option800", "generated option number 800", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option801", "o801", "option801", "generated option number 801", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option802", "o802", "option802", "generated option number 802", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option803", "o803", "option803", "generated option number 803", usage_t::NO, "", usage_t::STRING },
+	{ "option804", "o804", "option804", "generated option number 804", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option805", "o805", "option805", "generated option number 805", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option806", "o806", "option806", "generated option number 806", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option807", "o807", "option807", "generated option number 807", usage_t::NO, "", usage_t::STRING },
+	{ "option808", "o808", "option808", "generated option number 808", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option809", "o809", "option809", "generated option number 809", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option810", "o810", "option810", "generated option number 810", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option811", "o811", "option811", "generated option number 811", usage_t::NO, "", usage_t::STRING },
+	{ "option812", "o812", "option812", "generated option number 812", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option813", "o813", "option813", "generated option number 813", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option814", "o814", "option814", "generated option number 814", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option815", "o815", "option815", "generated option number 815", usage_t::NO, "", usage_t::STRING },
+	{ "option816", "o816", "option816", "generated option number 816", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option817", "o817", "option817", "generated option number 817", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option818", "o818", "option818", "generated option number 818", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option819", "o819", "option819", "generated option number 819", usage_t::NO, "", usage_t::STRING },
+	{ "option820", "o820", "option820", "generated option number 820", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option821", "o821", "option821", "generated option number 821", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option822", "o822", "option822", "generated option number 822", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option823", "o823", "option823", "generated option number 823", usage_t::NO, "", usage_t::STRING },
+	{ "option824", "o824", "option824", "generated option number 824", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option825", "o825", "option825", "generated option number 825", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option826", "o826", "option826", "generated option number 826", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option827", "o827", "option827", "generated option number 827", usage_t::NO, "", usage_t::STRING },
+	{ "option828", "o828", "option828", "generated option number 828", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option829", "o829", "option829", "generated option number 829", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option830", "o830", "option830", "generated option number 830", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option831", "o831", "option831", "generated option number 831", usage_t::NO, "", usage_t::STRING },
+	{ "option832", "o832", "option832", "generated option number 832", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option833", "o833", "option833", "generated option number 833", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option834", "o834", "option834", "generated option number 834", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option835", "o835", "option835", "generated option number 835", usage_t::NO, "", usage_t::STRING },
+	{ "option836", "o836", "option836", "generated option number 836", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option837", "o837", "option837", "generated option number 837", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option838", "o838", "option838", "generated option number 838", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option839", "o839", "option839", "generated option number 839", usage_t::NO, "", usage_t::STRING },
+	{ "option840", "o840", "option840", "generated option number 840", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option841", "o841", "option841", "generated option number 841", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option842", "o842", "option842", "generated option number 842", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option843", "o843", "option843", "generated option number 843", usage_t::NO, "", usage_t::STRING },
+	{ "option844", "o844", "option844", "generated option number 844", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option845", "o845", "option845", "generated option number 845", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option846", "o846", "option846", "generated option number 846", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option847", "o847", "option847", "generated option number 847", usage_t::NO, "", usage_t::STRING },
+	{ "option848", "o848", "option848", "generated option number 848", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option849", "o849", "option849", "generated option number 849", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option850", "o850", "option850", "generated option number 850", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option851", "o851", "option851", "generated option number 851", usage_t::NO, "", usage_t::STRING },
+	{ "option852", "o852", "option852", "generated option number 852", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option853", "o853", "option853", "generated option number 853", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option854", "o854", "option854", "generated option number 854", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option855", "o855", "option855", "generated option number 855", usage_t::NO, "", usage_t::STRING },
+	{ "option856", "o856", "option856", "generated option number 856", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option857", "o857", "option857", "generated option number 857", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option858", "o858", "option858", "generated option number 858", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option859", "o859", "option859", "generated option number 859", usage_t::NO, "", usage_t::STRING },
+	{ "option860", "o860", "option860", "generated option number 860", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option861", "o861", "option861", "generated option number 861", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option862", "o862", "option862", "generated option number 862", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option863", "o863", "option863", "generated option number 863", usage_t::NO, "", usage_t::STRING },
+	{ "option864", "o864", "option864", "generated option number 864", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option865", "o865", "option865", "generated option number 865", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option866", "o866", "option866", "generated option number 866", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option867", "o867", "option867", "generated option number 867", usage_t::NO, "", usage_t::STRING },
+	{ "option868", "o868", "option868", "generated option number 868", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option869", "o869", "option869", "generated option number 869", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option870", "o870", "option870", "generated option number 870", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option871", "o871", "option871", "generated option number 871", usage_t::NO, "", usage_t::STRING },
+	{ "option872", "o872", "option872", "generated option number 872", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option873", "o873", "option873", "generated option number 873", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option874", "o874", "option874", "generated option number 874", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option875", "o875", "option875", "generated option number 875", usage_t::NO, "", usage_t::STRING },
+	{ "option876", "o876", "option876", "generated option number 876", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option877", "o877", "option877", "generated option number 877", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option878", "o878", "option878", "generated option number 878", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option879", "o879", "option879", "generated option number 879", usage_t::NO, "", usage_t::STRING },
+	{ "option880", "o880", "option880", "generated option number 880", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option881", "o881", "option881", "generated option number 881", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option882", "o882", "option882", "generated option number 882", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option883", "o883", "option883", "generated option number 883", usage_t::NO, "", usage_t::STRING },
+	{ "option884", "o884", "option884", "generated option number 884", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option885", "o885", "option885", "generated option number 885", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option886", "o886", "option886", "generated option number 886", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option887", "o887", "option887", "generated option number 887", usage_t::NO, "", usage_t::STRING },
+	{ "option888", "o888", "option888", "generated option number 888", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option889", "o889", "option889", "generated option number 889", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option890", "o890", "option890", "generated option number 890", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option891", "o891", "option891", "generated option number 891", usage_t::NO, "", usage_t::STRING },
+	{ "option892", "o892", "option892", "generated option number 892", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option893", "o893", "option893", "generated option number 893", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option894", "o894", "option894", "generated option number 894", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option895", "o895", "option895", "generated option number 895", usage_t::NO, "", usage_t::STRING },
+	{ "option896", "o896", "option896", "generated option number 896", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option897", "o897", "option897", "generated option number 897", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option898", "o898", "option898", "generated option number 898", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option899", "o899", "option899", "generated option number 899", usage_t::NO, "", usage_t::STRING },
+	{ "option900", "o900", "option900", "generated option number 900", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option901", "o901", "option901", "generated option number 901", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option902", "o902", "option902", "generated option number 902", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option903", "o903", "option903", "generated option number 903", usage_t::NO, "", usage_t::STRING },
+	{ "option904", "o904", "option904", "generated option number 904", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option905", "o905", "option905", "generated option number 905", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option906", "o906", "option906", "generated option number 906", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option907", "o907", "option907", "generated option number 907", usage_t::NO, "", usage_t::STRING },
+	{ "option908", "o908", "option908", "generated option number 908", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option909", "o909", "option909", "generated option number 909", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option910", "o910", "option910", "generated option number 910", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option911", "o911", "option911", "generated option number 911", usage_t::NO, "", usage_t::STRING },
+	{ "option912", "o912", "option912", "generated option number 912", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option913", "o913", "option913", "generated option number 913", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option914", "o914", "option914", "generated option number 914", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option915", "o915", "option915", "generated option number 915", usage_t::NO, "", usage_t::STRING },
+	{ "option916", "o916", "option916", "generated option number 916", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option917", "o917", "option917", "generated option number 917", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option918", "o918", "option918", "generated option number 918", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option919", "o919", "option919", "generated option number 919", usage_t::NO, "", usage_t::STRING },
+	{ "option920", "o920", "option920", "generated option number 920", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option921", "o921", "option921", "generated option number 921", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option922", "o922", "option922", "generated option number 922", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option923", "o923", "option923", "generated option number 923", usage_t::NO, "", usage_t::STRING },
+	{ "option924", "o924", "option924", "generated option number 924", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option925", "o925", "option925", "generated option number 925", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option926", "o926", "option926", "generated option number 926", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option927", "o927", "option927", "generated option number 927", usage_t::NO, "", usage_t::STRING },
+	{ "option928", "o928", "option928", "generated option number 928", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option929", "o929", "option929", "generated option number 929", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option930", "o930", "option930", "generated option number 930", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option931", "o931", "option931", "generated option number 931", usage_t::NO, "", usage_t::STRING },
+	{ "option932", "o932", "option932", "generated option number 932", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option933", "o933", "option933", "generated option number 933", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option934", "o934", "option934", "generated option number 934", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option935", "o935", "option935", "generated option number 935", usage_t::NO, "", usage_t::STRING },
+	{ "option936", "o936", "option936", "generated option number 936", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option937", "o937", "option937", "generated option number 937", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option938", "o938", "option938", "generated option number 938", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option939", "o939", "option939", "generated option number 939", usage_t::NO, "", usage_t::STRING },
+	{ "option940", "o940", "option940", "generated option number 940", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option941", "o941", "option941", "generated option number 941", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option942", "o942", "option942", "generated option number 942", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option943", "o943", "option943", "generated option number 943", usage_t::NO, "", usage_t::STRING },
+	{ "option944", "o944", "option944", "generated option number 944", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option945", "o945", "option945", "generated option number 945", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option946", "o946", "option946", "generated option number 946", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option947", "o947", "option947", "generated option number 947", usage_t::NO, "", usage_t::STRING },
+	{ "option948", "o948", "option948", "generated option number 948", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option949", "o949", "option949", "generated option number 949", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option950", "o950", "option950", "generated option number 950", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option951", "o951", "option951", "generated option number 951", usage_t::NO, "", usage_t::STRING },
+	{ "option952", "o952", "option952", "generated option number 952", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option953", "o953", "option953", "generated option number 953", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option954", "o954", "option954", "generated option number 954", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option955", "o955", "option955", "generated option number 955", usage_t::NO, "", usage_t::STRING },
+	{ "option956", "o956", "option956", "generated option number 956", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option957", "o957", "option957", "generated option number 957", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option958", "o958", "option958", "generated option number 958", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option959", "o959", "option959", "generated option number 959", usage_t::NO, "", usage_t::STRING },
+	{ "option960", "o960", "option960", "generated option number 960", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option961", "o961", "option961", "generated option number 961", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option962", "o962", "option962", "generated option number 962", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option963", "o963", "option963", "generated option number 963", usage_t::NO, "", usage_t::STRING },
+	{ "option964", "o964", "option964", "generated option number 964", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option965", "o965", "option965", "generated option number 965", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option966", "o966", "option966", "generated option number 966", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option967", "o967", "option967", "generated option number 967", usage_t::NO, "", usage_t::STRING },
+	{ "option968", "o968", "option968", "generated option number 968", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option969", "o969", "option969", "generated option number 969", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option970", "o970", "option970", "generated option number 970", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option971", "o971", "option971", "generated option number 971", usage_t::NO, "", usage_t::STRING },
+	{ "option972", "o972", "option972", "generated option number 972", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option973", "o973", "option973", "generated option number 973", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option974", "o974", "option974", "generated option number 974", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option975", "o975", "option975", "generated option number 975", usage_t::NO, "", usage_t::STRING },
+	{ "option976", "o976", "option976", "generated option number 976", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option977", "o977", "option977", "generated option number 977", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option978", "o978", "option978", "generated option number 978", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option979", "o979", "option979", "generated option number 979", usage_t::NO, "", usage_t::STRING },
+	{ "option980", "o980", "option980", "generated option number 980", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option981", "o981", "option981", "generated option number 981", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option982", "o982", "option982", "generated option number 982", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option983", "o983", "option983", "generated option number 983", usage_t::NO, "", usage_t::STRING },
+	{ "option984", "o984", "option984", "generated option number 984", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option985", "o985", "option985", "generated option number 985", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option986", "o986", "option986", "generated option number 986", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option987", "o987", "option987", "generated option number 987", usage_t::NO, "", usage_t::STRING },
+	{ "option988", "o988", "option988", "generated option number 988", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option989", "o989", "option989", "generated option number 989", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option990", "o990", "option990", "generated option number 990", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option991", "o991", "option991", "generated option number 991", usage_t::NO, "", usage_t::STRING },
+	{ "option992", "o992", "option992", "generated option number 992", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option993", "o993", "option993", "generated option number 993", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option994", "o994", "option994", "generated option number 994", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option995", "o995", "option995", "generated option number 995", usage_t::NO, "", usage_t::STRING },
+	{ "option996", "o996", "option996", "generated option number 996", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option997", "o997", "option997", "generated option number 997", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option998", "o998", "option998", "generated option number 998", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option999", "o999", "option999", "generated option number 999", usage_t::NO, "", usage_t::STRING }
+};
+
+int main(int argc, char **argv) {
+
+	auto start = std::chrono::steady_clock::now();
+	size_t allocs = allocations;
+
+	std::vector<std::pair<std::string, usage_t::option_t>> options;
+	options.reserve(sizeof(specs) / sizeof(specs[0]));
+
+	for ( const auto& s : specs )
+		options.push_back({ s.option, { .key = s.key, .word = s.word, .desc = s.desc, .flag = s.flag, .name = s.name, .type = s.type }});
+
+	usage_t usage = {
+		.args = { argc, argv },
+		.info = {
+			.name = "startup",
+			.version = "1.0.0",
+			.author = "usage_cpp benchmark",
+			.description = "\nGenerated schema for the startup benchmark\n"
+		},
+		.options = std::move(options),
+		.commands = {
+		}
+	};
+
+	auto end = std::chrono::steady_clock::now();
+	allocs = allocations - allocs;
+
+	std::printf("%lld %zu\n", (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), allocs);
+	return usage.validated ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "usage.hpp"
+
+static size_t allocations = 0;
+
+// every form of new is counted: single and array, throwing and nothrow,
+// default and over-aligned
+static void* allocate(size_t n, size_t align = 0) {
+
+	allocations++;
+	n = n ? n : 1;
+
+	if ( align == 0 )
+		return std::malloc(n);
+
+	return std::aligned_alloc(align, ( n + align - 1 ) / align * align);
+}
+
+static void* allocate_or_throw(size_t n, size_t align = 0) {
+
+	if ( void* p = allocate(n, align))
+		return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t n) { return allocate_or_throw(n); }
+void* operator new[](size_t n) { return allocate_or_throw(n); }
+void* operator new(size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new(size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+
+// generated options: name, key, word, desc, flag, arg name, type
+static const struct {
+	const char *option, *key, *word, *desc;
+	usage_t::arg_flag flag;
+	const char* name;
+	usage_t::arg_type type;
+} specs[] = {
+	{ "option0", "o0", "option0", "generated option number 0", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option1", "o1", "option1", "generated option number 1", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option2", "o2", "option2", "generated option number 2", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option3", "o3", "option3", "generated option number 3", usage_t::NO, "", usage_t::STRING },
+	{ "option4", "o4", "option4", "generated option number 4", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option5", "o5", "option5", "generated option number 5", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option6", "o6", "option6", "generated option number 6", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option7", "o7", "option7", "generated option number 7", usage_t::NO, "", usage_t::STRING },
+	{ "option8", "o8", "option8", "generated option number 8", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option9", "o9", "option9", "generated option number 9", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option10", "o10", "option10", "generated option number 10", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option11", "o11", "option11", "generated option number 11", usage_t::NO, "", usage_t::STRING },
+	{ "option12", "o12", "option12", "generated option number 12", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option13", "o13", "option13", "generated option number 13", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option14", "o14", "option14", "generated option number 14", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option15", "o15", "option15", "generated option number 15", usage_t::NO, "", usage_t::STRING },
+	{ "option16", "o16", "option16", "generated option number 16", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option17", "o17", "option17", "generated option number 17", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option18", "o18", "option18", "generated option number 18", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option19", "o19", "option19", "generated option number 19", usage_t::NO, "", usage_t::STRING },
+	{ "option20", "o20", "option20", "generated option number 20", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option21", "o21", "option21", "generated option number 21", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option22", "o22", "option22", "generated option number 22", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option23", "o23", "option23", "generated option number 23", usage_t::NO, "", usage_t::STRING },
+	{ "option24", "o24", "option24", "generated option number 24", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option25", "o25", "option25", "generated option number 25", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option26", "o26", "option26", "generated option number 26", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option27", "o27", "option27", "generated option number 27", usage_t::NO, "", usage_t::STRING },
+	{ "option28", "o28", "option28", "generated option number 28", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option29", "o29", "option29", "generated option number 29", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option30", "o30", "option30", "generated option number 30", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option31", "o31", "option31", "generated option number 31", usage_t::NO, "", usage_t::STRING },
+	{ "option32", "o32", "option32", "generated option number 32", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option33", "o33", "option33", "generated option number 33", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option34", "o34", "option34", "generated option number 34", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option35", "o35", "option35", "generated option number 35", usage_t::NO, "", usage_t::STRING },
+	{ "option36", "o36", "option36", "generated option number 36", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option37", "o37", "option37", "generated option number 37", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option38", "o38", "option38", "generated option number 38", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option39", "o39", "option39", "generated option number 39", usage_t::NO, "", usage_t::STRING },
+	{ "option40", "o40", "option40", "generated option number 40", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option41", "o41", "option41", "generated option number 41", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option42", "o42", "option42", "generated option number 42", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option43", "o43", "option43", "generated option number 43", usage_t::NO, "", usage_t::STRING },
+	{ "option44", "o44", "option44", "generated option number 44", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option45", "o45", "option45", "generated option number 45", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option46", "o46", "option46", "generated option number 46", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option47", "o47", "option47", "generated option number 47", usage_t::NO, "", usage_t::STRING },
+	{ "option48", "o48", "option48", "generated option number 48", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option49", "o49", "option49", "generated option number 49", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option50", "o50", "option50", "generated option number 50", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option51", "o51", "option51", "generated option number 51", usage_t::NO, "", usage_t::STRING },
+	{ "option52", "o52", "option52", "generated option number 52", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option53", "o53", "option53", "generated option number 53", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option54", "o54", "option54", "generated option number 54", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option55", "o55", "option55", "generated option number 55", usage_t::NO, "", usage_t::STRING },
+	{ "option56", "o56", "option56", "generated option number 56", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option57", "o57", "option57", "generated option number 57", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option58", "o58", "option58", "generated option number 58", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option59", "o59", "option59", "generated option number 59", usage_t::NO, "", usage_t::STRING },
+	{ "option60", "o60", "option60", "generated option number 60", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option61", "o61", "option61", "generated option number 61", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option62", "o62", "option62", "generated option number 62", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option63", "o63", "option63", "generated option number 63", usage_t::NO, "", usage_t::STRING },
+	{ "option64", "o64", "option64", "generated option number 64", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option65", "o65", "option65", "generated option number 65", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option66", "o66", "option66", "generated option number 66", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option67", "o67", "option67", "generated option number 67", usage_t::NO, "", usage_t::STRING },
+	{ "option68", "o68", "option68", "generated option number 68", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option69", "o69", "option69", "generated option number 69", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option70", "o70", "option70", "generated option number 70", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option71", "o71", "option71", "generated option number 71", usage_t::NO, "", usage_t::STRING },
+	{ "option72", "o72", "option72", "generated option number 72", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option73", "o73", "option73", "generated option number 73", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option74", "o74", "option74", "generated option number 74", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option75", "o75", "option75", "generated option number 75", usage_t::NO, "", usage_t::STRING },
+	{ "option76", "o76", "option76", "generated option number 76", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option77", "o77", "option77", "generated option number 77", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option78", "o78", "option78", "generated option number 78", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option79", "o79", "option79", "generated option number 79", usage_t::NO, "", usage_t::STRING },
+	{ "option80", "o80", "option80", "generated option number 80", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option81", "o81", "option81", "generated option number 81", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option82", "o82", "option82", "generated option number 82", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option83", "o83", "option83", "generated option number 83", usage_t::NO, "", usage_t::STRING },
+	{ "option84", "o84", "option84", "generated option number 84", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option85", "o85", "option85", "generated option number 85", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option86", "o86", "option86", "generated option number 86", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option87", "o87", "option87", "generated option number 87", usage_t::NO, "", usage_t::STRING },
+	{ "option88", "o88", "option88", "generated option number 88", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option89", "o89", "option89", "generated option number 89", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option90", "o90", "option90", "generated option number 90", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option91", "o91", "option91", "generated option number 91", usage_t::NO, "", usage_t::STRING },
+	{ "option92", "o92", "option92", "generated option number 92", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option93", "o93", "option93", "generated option number 93", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option94", "o94", "option94", "generated option number 94", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option95", "o95", "option95", "generated option number 95", usage_t::NO, "", usage_t::STRING },
+	{ "option96", "o96", "option96", "generated option number 96", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option97", "o97", "option97", "generated option number 97", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option98", "o98", "option98", "generated option number 98", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option99", "o99", "option99", "generated option number 99", usage_t::NO, "", usage_t::STRING }
+};
+
+int main(int argc, char **argv) {
+
+	auto start = std::chrono::steady_clock::now();
+	size_t allocs = allocations;
+
+	std::vector<std::pair<std::string, usage_t::option_t>> options;
+	options.reserve(sizeof(specs) / sizeof(specs[0]));
+
+	for ( const auto& s : specs )
+		options.push_back({ s.option, { .key = s.key, .word = s.word, .desc = s.desc, .flag = s.flag, .name = s.name, .type = s.type }});
+
+	usage_t usage = {
+		.args = { argc, argv },
+		.info = {
+			.name = "startup",
+			.version = "1.0.0",
+			.author = "usage_cpp benchmark",
+			.description = "\nGenerated schema for the startup benchmark\n"
+		},
+		.options = std::move(options),
+		.commands = {
+		}
+	};
+
+	auto end = std::chrono::steady_clock::now();
+	allocs = allocations - allocs;
+
+	std::printf("%lld %zu\n", (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), allocs);
+	return usage.validated ? 0 : 1;
+}
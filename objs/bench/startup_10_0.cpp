@@ -0,0 +1,100 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "usage.hpp"
+
+static size_t allocations = 0;
+
+// every form of new is counted: single and array, throwing and nothrow,
+// default and over-aligned
+static void* allocate(size_t n, size_t align = 0) {
+
+	allocations++;
+	n = n ? n : 1;
+
+	if ( align == 0 )
+		return std::malloc(n);
+
+	return std::aligned_alloc(align, ( n + align - 1 ) / align * align);
+}
+
+static void* allocate_or_throw(size_t n, size_t align = 0) {
+
+	if ( void* p = allocate(n, align))
+		return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t n) { return allocate_or_throw(n); }
+void* operator new[](size_t n) { return allocate_or_throw(n); }
+void* operator new(size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a) { return allocate_or_throw(n, (size_t)a); }
+void* operator new(size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { return allocate(n); }
+void* operator new(size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+void* operator new[](size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return allocate(n, (size_t)a); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+
+// generated options: name, key, word, desc, flag, arg name, type
+static const struct {
+	const char *option, *key, *word, *desc;
+	usage_t::arg_flag flag;
+	const char* name;
+	usage_t::arg_type type;
+} specs[] = {
+	{ "option0", "o0", "option0", "generated option number 0", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option1", "o1", "option1", "generated option number 1", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option2", "o2", "option2", "generated option number 2", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option3", "o3", "option3", "generated option number 3", usage_t::NO, "", usage_t::STRING },
+	{ "option4", "o4", "option4", "generated option number 4", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option5", "o5", "option5", "generated option number 5", usage_t::REQUIRED, "number", usage_t::INT },
+	{ "option6", "o6", "option6", "generated option number 6", usage_t::OPTIONAL, "value", usage_t::STRING },
+	{ "option7", "o7", "option7", "generated option number 7", usage_t::NO, "", usage_t::STRING },
+	{ "option8", "o8", "option8", "generated option number 8", usage_t::REQUIRED, "value", usage_t::STRING },
+	{ "option9", "o9", "option9", "generated option number 9", usage_t::REQUIRED, "number", usage_t::INT }
+};
+
+int main(int argc, char **argv) {
+
+	auto start = std::chrono::steady_clock::now();
+	size_t allocs = allocations;
+
+	std::vector<std::pair<std::string, usage_t::option_t>> options;
+	options.reserve(sizeof(specs) / sizeof(specs[0]));
+
+	for ( const auto& s : specs )
+		options.push_back({ s.option, { .key = s.key, .word = s.word, .desc = s.desc, .flag = s.flag, .name = s.name, .type = s.type }});
+
+	usage_t usage = {
+		.args = { argc, argv },
+		.info = {
+			.name = "startup",
+			.version = "1.0.0",
+			.author = "usage_cpp benchmark",
+			.description = "\nGenerated schema for the startup benchmark\n"
+		},
+		.options = std::move(options),
+		.commands = {
+		}
+	};
+
+	auto end = std::chrono::steady_clock::now();
+	allocs = allocations - allocs;
+
+	std::printf("%lld %zu\n", (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), allocs);
+	return usage.validated ? 0 : 1;
+}
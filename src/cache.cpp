@@ -0,0 +1,72 @@
+#include <iterator>
+
+#include "usage.hpp"
+#include "util.hpp"
+
+// FNV-1a over the arguments, each followed by its length
+static uint64_t hash_args(const std::vector<std::string>& args) {
+
+	fnv1a_t h;
+
+	for ( const auto& a : args )
+		h.add(a);
+
+	return h.hash;
+}
+
+usage_t::cache_t::cache_t(const usage_t& schema, size_t capacity) : _schema(&schema), _capacity(capacity == 0 ? 1 : capacity) {}
+
+std::shared_ptr<const usage_t::parsed_t> usage_t::cache_t::parse(const std::vector<std::string>& args) {
+
+	uint64_t h = hash_args(args);
+	auto range = this -> _index.equal_range(h);
+
+	for ( auto it = range.first; it != range.second; it++ ) {
+
+		if ( it -> second -> args != args )
+			continue;
+
+		this -> _hits++;
+		this -> _lru.splice(this -> _lru.begin(), this -> _lru, it -> second);
+		return this -> _lru.front().result;
+	}
+
+	this -> _misses++;
+
+	if ( this -> _lru.size() >= this -> _capacity ) {
+
+		auto last = std::prev(this -> _lru.end());
+		auto range = this -> _index.equal_range(last -> hash);
+
+		for ( auto it = range.first; it != range.second; it++ )
+			if ( it -> second == last ) {
+				this -> _index.erase(it);
+				break;
+			}
+
+		this -> _lru.pop_back();
+	}
+
+	this -> _lru.push_front({ .hash = h, .args = args, .result = this -> _schema -> parse(args) });
+	this -> _index.emplace(h, this -> _lru.begin());
+
+	return this -> _lru.front().result;
+}
+
+size_t usage_t::cache_t::size() const {
+	return this -> _lru.size();
+}
+
+size_t usage_t::cache_t::hits() const {
+	return this -> _hits;
+}
+
+size_t usage_t::cache_t::misses() const {
+	return this -> _misses;
+}
+
+void usage_t::cache_t::clear() {
+
+	this -> _lru.clear();
+	this -> _index.clear();
+}
@@ -0,0 +1,419 @@
+#include <sstream>
+#include <vector>
+#include <functional>
+
+#include "usage.hpp"
+#include "parser.hpp"
+
+// Shell completion: static scripts generated from options/commands, and the
+// hidden `prog __complete <words..>` query answered straight from the schema.
+
+static const std::string complete_marker = "__complete";
+
+// option spellings as typed on the command line: "-k", "--word"
+static std::vector<std::string> spellings(const usage_t::option_t& opt) {
+
+	std::vector<std::string> v;
+
+	if ( !opt.key.empty()) v.push_back("-" + opt.key);
+	if ( !opt.word.empty()) v.push_back("--" + opt.word);
+	return v;
+}
+
+// the option an option word leaves waiting for the next word, its required
+// argument - by the rules of parse_args: -k or --word, or a bundle of short
+// keys ending with it (-abk). None for an attached value (-k=value, -kvalue).
+static const usage_t::option_t* awaiting(const usage_t& u, const std::string& w) {
+
+	usage_view_t v = { &u };
+	std::string a(trim(w));
+	bool bundled = has_prefix(a, "-") && !has_prefix(a, "--");
+
+	while ( has_prefix(a, "--") && a != "--" )
+		a.erase(0, 1);
+
+	if ( !has_prefix(a, "-") || a == "--" )
+		return nullptr;
+
+	a.erase(0, 1);
+	a = l_trim(a);
+
+	auto required = [&u, &v](int idx) {
+		return v.flag(idx) == usage_t::arg_flag::REQUIRED ? &u.options[idx].second : nullptr;
+	};
+
+	if ( a.empty())
+		return nullptr;
+	else if ( int idx = v.find(a); idx >= 0 )
+		return required(idx);
+
+	if ( auto pos = a.find('='); pos != std::string::npos && a.at(0) != '0' )
+		if ( int idx = v.find(a.substr(0, pos)); idx >= 0 && v.flag(idx) != usage_t::arg_flag::NO )
+			return nullptr;
+
+	if ( !bundled || a.size() < 2 )
+		return nullptr;
+
+	// the first declared option of a single character key, as parse_args has it
+	auto short_key = [&v](char ch) {
+
+		for ( size_t i = 0; i < v.size(); i++ )
+			if ( v.key(i).size() == 1 && v.key(i).front() == ch )
+				return (int)i;
+		return -1;
+	};
+
+	for ( size_t i = 0; i < a.size(); i++ ) {
+
+		int idx = short_key(a[i]);
+
+		if ( idx < 0 )
+			return nullptr;
+		else if ( v.flag(idx) != usage_t::arg_flag::NO )
+			return i + 1 == a.size() ? required(idx) : nullptr;
+	}
+
+	return nullptr;
+}
+
+bool usage_t::completing() const {
+
+	return this -> args.marker(complete_marker);
+}
+
+std::vector<std::string> usage_t::complete() const {
+
+	if ( !this -> completing())
+		return {};
+
+	return this -> complete(std::vector<std::string>(this -> args._vec.begin() + 1, this -> args._vec.end()));
+}
+
+std::vector<std::string> usage_t::complete(const std::vector<std::string>& words) const {
+
+	const usage_t* node = this;
+	std::string partial = words.empty() ? "" : words.back();
+	const usage_t::option_t* pending = nullptr;
+
+	// walk the words before the one being completed: follow commands, skip
+	// the arguments of options that require one
+	for ( size_t i = 0; i + 1 < words.size(); i++ ) {
+
+		std::string w(trim(words[i]));
+		pending = nullptr;
+
+		// the rest are positionals: neither options nor commands
+		if ( w == "--" )
+			return {};
+
+		if ( has_prefix(w, "-")) {
+
+			if (( pending = awaiting(*node, words[i])) != nullptr && i + 2 < words.size()) {
+				i++;
+				pending = nullptr;
+			}
+			continue;
+		}
+
+		for ( const auto& c : node -> commands ) {
+
+			if ( w != c.first )
+				continue;
+
+			if ( !c.second ) // raw passthrough: its arguments are foreign
+				return {};
+
+			node = c.second.get();
+			break;
+		}
+	}
+
+	std::vector<std::string> res;
+
+	if ( pending != nullptr ) {
+
+		if ( pending -> type == usage_t::arg_type::BOOL )
+			for ( const char* v : { "true", "false" })
+				if ( has_prefix(v, partial))
+					res.push_back(v);
+		return res;
+	}
+
+	if ( !has_prefix(partial, "-"))
+		for ( const auto& c : node -> commands )
+			if ( has_prefix(c.first, partial))
+				res.push_back(c.first);
+
+	if ( has_prefix(partial, "-") || ( partial.empty() && res.empty()))
+		for ( const auto& opt : node -> options )
+			for ( const auto& s : spellings(opt.second))
+				if ( has_prefix(s, partial))
+					res.push_back(s);
+
+	return res;
+}
+
+// every node of the command tree, keyed by its path ("" for the root,
+// "/cmd/sub" below it); raw passthroughs have no usage_t
+struct completion_node_t {
+	std::string path;
+	const usage_t* usage;
+};
+
+static void collect(const usage_t* u, const std::string& path, std::vector<completion_node_t>& nodes) {
+
+	nodes.push_back({ path, u });
+
+	if ( u == nullptr )
+		return;
+
+	for ( const auto& c : u -> commands )
+		collect(c.second.get(), path + "/" + c.first, nodes);
+}
+
+static std::string quote(const std::string& s, bool fish) {
+
+	std::string q("'");
+
+	for ( char ch : s ) {
+		if ( ch == '\'' ) q += fish ? "\\'" : "'\\''";
+		else if ( ch == '\\' && fish ) q += "\\\\";
+		else q += ch;
+	}
+
+	return q + "'";
+}
+
+static std::string identifier(const std::string& s) {
+
+	std::string id;
+
+	for ( char ch : s )
+		id += std::isalnum((unsigned char)ch) ? ch : '_';
+	return id;
+}
+
+std::string usage_t::completion(const std::string& shell) const {
+
+	std::string prog = this -> args.cmd();
+
+	if ( auto pos = prog.find_last_of('/'); pos != std::string::npos )
+		prog.erase(0, pos + 1);
+
+	if ( prog.empty())
+		prog = this -> info.name;
+
+	std::string fn = "_" + identifier(prog) + "_complete";
+	bool fish = shell == "fish";
+
+	if ( shell != "bash" && shell != "zsh" && !fish )
+		return "";
+
+	std::vector<completion_node_t> nodes;
+	collect(this, "", nodes);
+
+	// the shells differ in syntax only, the tables are the same: patterns of
+	// one case arm are separated by '|', or by ' ' for fish
+	std::string sep = fish ? " " : "|";
+	std::stringstream cmds, argopts, boolopts, cands, shorts, longkeys;
+
+	for ( const auto& n : nodes ) {
+
+		if ( n.usage == nullptr )
+			continue;
+
+		std::vector<std::string> arg_forms, bool_forms, words;
+
+		for ( const auto& c : n.usage -> commands ) {
+			cmds << ( cmds.tellp() == 0 ? "" : sep ) << quote(n.path + "/" + c.first, fish);
+			words.push_back(c.first);
+		}
+
+		for ( const auto& opt : n.usage -> options ) {
+			for ( const auto& s : spellings(opt.second)) {
+				words.push_back(s);
+				if ( opt.second.flag == usage_t::arg_flag::REQUIRED )
+					( opt.second.type == usage_t::arg_type::BOOL ? bool_forms : arg_forms ).push_back(n.path + ":" + s);
+			}
+		}
+
+		// single character keys, for bundles: f those without an argument,
+		// a those requiring one - a bundle ending with one of them takes the
+		// next word as its argument
+		std::string flag_keys, arg_keys;
+
+		for ( const auto& opt : n.usage -> options ) {
+
+			if ( opt.second.key.size() == 1 && ( flag_keys + arg_keys ).find(opt.second.key) == std::string::npos ) {
+				if ( opt.second.flag == usage_t::arg_flag::NO ) flag_keys += opt.second.key;
+				else if ( opt.second.flag == usage_t::arg_flag::REQUIRED ) arg_keys += opt.second.key;
+			}
+
+			// a longer key is matched whole before any bundle is
+			if ( opt.second.key.size() > 1 && opt.second.flag != usage_t::arg_flag::REQUIRED )
+				longkeys << ( longkeys.tellp() == 0 ? "" : sep ) << quote(n.path + ":-" + opt.second.key, fish);
+		}
+
+		if ( !arg_keys.empty()) {
+			if ( fish ) shorts << "\t\t\t\tcase " << quote(n.path, true) << "\n\t\t\t\t\tset f " << quote(flag_keys, true) <<
+				"\n\t\t\t\t\tset a " << quote(arg_keys, true) << "\n";
+			else shorts << "\t\t\t\t" << quote(n.path, false) << ") f=" << quote(flag_keys, false) << " a=" << quote(arg_keys, false) << " ;;\n";
+		}
+
+		for ( const auto& f : arg_forms )
+			argopts << ( argopts.tellp() == 0 ? "" : sep ) << quote(f, fish);
+
+		for ( const auto& f : bool_forms )
+			boolopts << ( boolopts.tellp() == 0 ? "" : sep ) << quote(f, fish);
+
+		if ( fish ) {
+
+			cands << "\t\tcase " << quote(n.path, true) << "\n\t\t\t";
+			if ( words.empty()) cands << "return";
+			else cands << "printf '%s\\n'";
+			for ( const auto& w : words )
+				cands << " " << quote(w, true);
+			cands << "\n";
+
+		} else if ( shell == "bash" ) {
+
+			std::string list;
+			for ( const auto& w : words )
+				list += ( list.empty() ? "" : " " ) + w;
+			cands << "\t\t" << quote(n.path, false) << ") cands=" << quote(list, false) << " ;;\n";
+
+		} else {
+
+			cands << "\t\t" << quote(n.path, false) << ") compadd --";
+			for ( const auto& w : words )
+				cands << " " << quote(w, false);
+			cands << " ;;\n";
+		}
+	}
+
+	// bash, zsh: `case` tables; options taking an argument skip it, commands
+	// extend the node path, the previous word decides value completion
+	std::stringstream ss;
+
+	if ( shell == "bash" ) {
+
+		ss << "# bash completion for " << prog << ", generated by usage_cpp\n" <<
+			fn << "() {\n" <<
+			"\tlocal cur=\"${COMP_WORDS[COMP_CWORD]}\" prev=\"${COMP_WORDS[COMP_CWORD-1]}\" node=\"\" cands=\"\" w i b f a\n" <<
+			"\tfor (( i = 1; i < COMP_CWORD; i++ )); do\n" <<
+			"\t\tw=\"${COMP_WORDS[i]}\"\n" <<
+			"\t\t[ \"$w\" = \"--\" ] && return\n";
+		if ( argopts.tellp() != 0 || boolopts.tellp() != 0 )
+			ss << "\t\tcase \"$node:$w\" in\n\t\t\t" << argopts.str() << ( argopts.tellp() != 0 && boolopts.tellp() != 0 ? "|" : "" ) << boolopts.str() <<
+				") (( i++ )); continue ;;\n\t\tesac\n";
+		if ( shorts.tellp() != 0 && longkeys.tellp() != 0 )
+			ss << "\t\tcase \"$node:$w\" in\n\t\t\t" << longkeys.str() << ") continue ;;\n\t\tesac\n";
+		if ( shorts.tellp() != 0 )
+			ss << "\t\tif [[ \"$w\" == -[!-]?* ]]; then\n" <<
+				"\t\t\tb=\"${w#-}\" f=\"\" a=\"\"\n" <<
+				"\t\t\tcase \"$node\" in\n" << shorts.str() << "\t\t\tesac\n" <<
+				"\t\t\twhile [ -n \"$b\" ] && [[ \"$f\" == *\"${b:0:1}\"* ]]; do b=\"${b:1}\"; done\n" <<
+				"\t\t\t[ ${#b} = 1 ] && [[ \"$a\" == *\"$b\"* ]] && (( i++ ))\n" <<
+				"\t\t\tcontinue\n" <<
+				"\t\tfi\n";
+		if ( cmds.tellp() != 0 )
+			ss << "\t\tcase \"$node/$w\" in\n\t\t\t" << cmds.str() << ") node=\"$node/$w\" ;;\n\t\tesac\n";
+		ss << "\tdone\n";
+		if ( boolopts.tellp() != 0 || argopts.tellp() != 0 ) {
+			ss << "\tcase \"$node:$prev\" in\n";
+			if ( boolopts.tellp() != 0 )
+				ss << "\t\t" << boolopts.str() << ") COMPREPLY=( $(compgen -W \"true false\" -- \"$cur\") ); return ;;\n";
+			if ( argopts.tellp() != 0 )
+				ss << "\t\t" << argopts.str() << ") COMPREPLY=(); return ;;\n";
+			ss << "\tesac\n";
+		}
+		if ( shorts.tellp() != 0 ) // the argument of a bundle's last option
+			ss << "\t(( i > COMP_CWORD )) && return\n";
+		ss << "\tcase \"$node\" in\n" << cands.str() << "\tesac\n" <<
+			"\tCOMPREPLY=( $(compgen -W \"$cands\" -- \"$cur\") )\n" <<
+			"}\n" <<
+			"complete -o default -F " << fn << " " << prog << "\n";
+
+	} else if ( shell == "zsh" ) {
+
+		ss << "#compdef " << prog << "\n# zsh completion for " << prog << ", generated by usage_cpp\n" <<
+			fn << "() {\n" <<
+			"\tlocal node=\"\" w i b f a\n" <<
+			"\tfor (( i = 2; i < CURRENT; i++ )); do\n" <<
+			"\t\tw=\"${words[i]}\"\n" <<
+			"\t\t[[ \"$w\" == \"--\" ]] && { _files; return }\n";
+		if ( argopts.tellp() != 0 || boolopts.tellp() != 0 )
+			ss << "\t\tcase \"$node:$w\" in\n\t\t\t" << argopts.str() << ( argopts.tellp() != 0 && boolopts.tellp() != 0 ? "|" : "" ) << boolopts.str() <<
+				") (( i++ )); continue ;;\n\t\tesac\n";
+		if ( shorts.tellp() != 0 && longkeys.tellp() != 0 )
+			ss << "\t\tcase \"$node:$w\" in\n\t\t\t" << longkeys.str() << ") continue ;;\n\t\tesac\n";
+		if ( shorts.tellp() != 0 )
+			ss << "\t\tif [[ \"$w\" == -[^-]?* ]]; then\n" <<
+				"\t\t\tb=\"${w#-}\" f=\"\" a=\"\"\n" <<
+				"\t\t\tcase \"$node\" in\n" << shorts.str() << "\t\t\tesac\n" <<
+				"\t\t\twhile [[ -n \"$b\" && \"$f\" == *\"${b[1]}\"* ]]; do b=\"${b[2,-1]}\"; done\n" <<
+				"\t\t\t[[ ${#b} == 1 && \"$a\" == *\"$b\"* ]] && (( i++ ))\n" <<
+				"\t\t\tcontinue\n" <<
+				"\t\tfi\n";
+		if ( cmds.tellp() != 0 )
+			ss << "\t\tcase \"$node/$w\" in\n\t\t\t" << cmds.str() << ") node=\"$node/$w\" ;;\n\t\tesac\n";
+		ss << "\tdone\n";
+		if ( boolopts.tellp() != 0 || argopts.tellp() != 0 ) {
+			ss << "\tcase \"$node:${words[CURRENT-1]}\" in\n";
+			if ( boolopts.tellp() != 0 )
+				ss << "\t\t" << boolopts.str() << ") compadd true false; return ;;\n";
+			if ( argopts.tellp() != 0 )
+				ss << "\t\t" << argopts.str() << ") _files; return ;;\n";
+			ss << "\tesac\n";
+		}
+		if ( shorts.tellp() != 0 )
+			ss << "\t(( i > CURRENT )) && { _files; return }\n";
+		ss << "\tcase \"$node\" in\n" << cands.str() << "\t\t*) _files ;;\n\tesac\n" <<
+			"}\n" <<
+			"compdef " << fn << " " << prog << "\n";
+
+	} else {
+
+		ss << "# fish completion for " << prog << ", generated by usage_cpp\n" <<
+			"function " << fn << "\n" <<
+			"\tset -l tokens (commandline -opc)\n" <<
+			"\tset -l node ''\n" <<
+			"\tset -l skip 0\n" <<
+			"\tfor w in $tokens[2..-1]\n" <<
+			"\t\tif test $skip = 1\n\t\t\tset skip 0\n\t\t\tcontinue\n\t\tend\n" <<
+			"\t\tif test \"$w\" = '--'\n\t\t\t__fish_complete_path (commandline -ct)\n\t\t\treturn\n\t\tend\n";
+		if ( argopts.tellp() != 0 || boolopts.tellp() != 0 )
+			ss << "\t\tswitch \"$node:$w\"\n\t\t\tcase " << argopts.str() << ( argopts.tellp() != 0 && boolopts.tellp() != 0 ? " " : "" ) << boolopts.str() <<
+				"\n\t\t\t\tset skip 1\n\t\t\t\tcontinue\n\t\tend\n";
+		if ( shorts.tellp() != 0 && longkeys.tellp() != 0 )
+			ss << "\t\tswitch \"$node:$w\"\n\t\t\tcase " << longkeys.str() << "\n\t\t\t\tcontinue\n\t\tend\n";
+		if ( shorts.tellp() != 0 )
+			ss << "\t\tif string match -qr -- '^-[^-].' \"$w\"\n" <<
+				"\t\t\tset -l b (string sub -s 2 -- \"$w\")\n" <<
+				"\t\t\tset -l f ''\n\t\t\tset -l a ''\n" <<
+				"\t\t\tswitch \"$node\"\n" << shorts.str() << "\t\t\tend\n" <<
+				"\t\t\twhile test -n \"$b\"; and contains -- (string sub -l 1 -- \"$b\") (string split '' -- \"$f\")\n" <<
+				"\t\t\t\tset b (string sub -s 2 -- \"$b\")\n\t\t\tend\n" <<
+				"\t\t\tif test (string length -- \"$b\") = 1; and contains -- \"$b\" (string split '' -- \"$a\")\n" <<
+				"\t\t\t\tset skip 1\n\t\t\tend\n" <<
+				"\t\t\tcontinue\n\t\tend\n";
+		if ( cmds.tellp() != 0 )
+			ss << "\t\tswitch \"$node/$w\"\n\t\t\tcase " << cmds.str() << "\n\t\t\t\tset node \"$node/$w\"\n\t\tend\n";
+		ss << "\tend\n";
+		if ( shorts.tellp() != 0 ) // the argument of a bundle's last option
+			ss << "\tif test $skip = 1; and string match -qr -- '^-[^-].' \"$tokens[-1]\"\n\t\t__fish_complete_path (commandline -ct)\n\t\treturn\n\tend\n";
+		if ( boolopts.tellp() != 0 || argopts.tellp() != 0 ) {
+			ss << "\tswitch \"$node:$tokens[-1]\"\n";
+			if ( boolopts.tellp() != 0 )
+				ss << "\t\tcase " << boolopts.str() << "\n\t\t\tprintf '%s\\n' true false\n\t\t\treturn\n";
+			if ( argopts.tellp() != 0 )
+				ss << "\t\tcase " << argopts.str() << "\n\t\t\t__fish_complete_path (commandline -ct)\n\t\t\treturn\n";
+			ss << "\tend\n";
+		}
+		ss << "\tswitch \"$node\"\n" << cands.str() << "\tend\n" <<
+			"end\n" <<
+			"complete -c " << prog << " -f -a '(" << fn << ")'\n";
+	}
+
+	return ss.str();
+}
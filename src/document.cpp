@@ -0,0 +1,318 @@
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cctype>
+
+#include "usage.hpp"
+#include "help.hpp"
+#include "util.hpp"
+
+// Documentation of the whole commands tree: help text, man page, Markdown and
+// a JSON schema. Each command's own part is rendered on first use and kept in
+// its usage_t's help_cache; a tree is put together from those parts.
+
+static const std::string export_marker = "__export";
+
+static const char* doc_names[] = { "text", "man", "markdown", "json" };
+
+static std::string trim(const std::string& s) {
+
+	size_t first = s.find_first_not_of(" \t\n\r");
+	size_t last = s.find_last_not_of(" \t\n\r");
+	return first == std::string::npos ? "" : s.substr(first, last - first + 1);
+}
+
+static std::string basename(const std::string& cmd) {
+
+	size_t pos = cmd.rfind('/');
+	return pos == std::string::npos ? cmd : cmd.substr(pos + 1);
+}
+
+// a command's command line
+static std::string join(const std::string& cmd, const std::string& name) {
+
+	return cmd.empty() ? name : cmd + " " + name;
+}
+
+// as in help: "-k, --word <arg>"
+static std::string spelling(const usage_t::option_t& o) {
+
+	std::string s;
+
+	if ( !o.key.empty()) s += "-" + o.key;
+	if ( !o.key.empty() && !o.word.empty()) s += ", ";
+	if ( !o.word.empty()) s += "--" + o.word;
+
+	if ( o.flag == usage_t::arg_flag::REQUIRED )
+		s += " <" + ( o.name.empty() ? "arg" : o.name ) + ">";
+	else if ( o.flag == usage_t::arg_flag::OPTIONAL )
+		s += " [" + ( o.name.empty() ? "arg" : o.name ) + "]";
+
+	return s;
+}
+
+static bool listed(const std::pair<std::string, usage_t::option_t>& opt) {
+
+	return !opt.first.empty() && ( !opt.second.key.empty() || !opt.second.word.empty());
+}
+
+static std::string man_escape(const std::string& s) {
+
+	std::string r;
+
+	for ( size_t i = 0; i < s.size(); i++ ) {
+
+		// a line starting with a control character would be taken as a request
+		if (( i == 0 || s[i - 1] == '\n' ) && ( s[i] == '.' || s[i] == '\'' ))
+			r += "\\&";
+
+		if ( s[i] == '\\' ) r += "\\e";
+		else if ( s[i] == '-' ) r += "\\-";
+		else r += s[i];
+	}
+
+	return r;
+}
+
+// Markdown text: characters that would start emphasis or code taken literally
+static std::string md_escape(const std::string& s) {
+
+	std::string r;
+
+	for ( char c : s ) {
+
+		if ( c == '\\' || c == '`' || c == '*' || c == '_' )
+			r += '\\';
+		r += c;
+	}
+
+	return r;
+}
+
+// s as a Markdown code span, or with a block set a fenced block: the fence is
+// a backtick longer than any run of them in s, which cannot end it then
+static std::string md_code(const std::string& s, bool block = false) {
+
+	size_t longest = 0;
+
+	for ( size_t i = 0, run = 0; i < s.size(); i++ ) {
+		run = s[i] == '`' ? run + 1 : 0;
+		longest = std::max(longest, run);
+	}
+
+	std::string fence(std::max<size_t>(block ? 3 : 1, longest + 1), '`');
+
+	if ( block )
+		return fence + "\n" + s + "\n" + fence + "\n";
+
+	// a space keeps a backtick at either end off the fence
+	std::string pad = !s.empty() && ( s.front() == '`' || s.back() == '`' ) ? " " : "";
+	return fence + pad + s + pad + fence;
+}
+
+// a command's own part, commands below it not included. A JSON object is
+// left open, in its "commands" array.
+static std::string render(const usage_t& u, const std::string& cmd, usage_t::doc_type type, size_t depth) {
+
+	static const char* flags[] = { "no", "required", "optional" };
+	static const char* types[] = { "string", "int", "float", "bool", "hex" };
+
+	std::string description = trim(u.info.description);
+	std::string s;
+
+	if ( type == usage_t::doc_type::MAN ) {
+
+		if ( depth == 0 ) {
+
+			std::string name = u.info.name.empty() ? basename(cmd) : u.info.name;
+			std::string title = name;
+
+			// one argument to .TH: a subcommand's words joined, "EXAMPLE-GREET"
+			for ( auto& c : title )
+				c = c == ' ' ? '-' : std::toupper((unsigned char)c);
+
+			s += ".TH \"" + man_escape(title) + "\" 1 \"\" \"" + man_escape(trim(name + " " + u.info.version)) + "\"\n";
+			s += ".SH NAME\n" + man_escape(basename(cmd)) + ( description.empty() ? "" : " \\- " + man_escape(description)) + "\n";
+			s += ".SH SYNOPSIS\n.B " + man_escape(basename(cmd)) + "\n" + man_escape(u.info.usage) + "\n";
+
+			if ( !u.options.empty())
+				s += ".SH OPTIONS\n";
+
+		} else {
+			s += ".SS " + man_escape(basename(cmd)) + "\n";
+			s += ".B " + man_escape(basename(cmd)) + "\n" + man_escape(u.info.usage) + "\n";
+			if ( !description.empty())
+				s += ".PP\n" + man_escape(description) + "\n";
+		}
+
+		for ( const auto& opt : u.options )
+			if ( listed(opt))
+				s += ".TP\n.B " + man_escape(spelling(opt.second)) + "\n" + man_escape(opt.second.desc) + "\n";
+
+		if ( depth == 0 && !u.commands.empty())
+			s += ".SH COMMANDS\n";
+
+	} else if ( type == usage_t::doc_type::MARKDOWN ) {
+
+		s += ( depth == 0 ? "" : "\n" ) + std::string(std::min<size_t>(6, depth + 1), '#') + " " + md_escape(basename(cmd)) + "\n\n";
+
+		if ( !description.empty())
+			s += md_escape(description) + "\n\n";
+
+		s += md_code(basename(cmd) + " " + u.info.usage, true);
+
+		if ( std::any_of(u.options.begin(), u.options.end(), listed))
+			s += "\n";
+
+		for ( const auto& opt : u.options )
+			if ( listed(opt))
+				s += "- " + md_code(spelling(opt.second)) + ( opt.second.desc.empty() ? "" : ": " + md_escape(opt.second.desc)) + "\n";
+
+	} else if ( type == usage_t::doc_type::JSON ) {
+
+		s += "{\"name\":" + json_quote(depth == 0 && !u.info.name.empty() ? u.info.name : basename(cmd.substr(cmd.rfind(' ') + 1)));
+
+		if ( depth == 0 ) {
+			if ( !u.info.version.empty()) s += ",\"version\":" + json_quote(u.info.version);
+			if ( !u.info.author.empty()) s += ",\"author\":" + json_quote(u.info.author);
+			if ( !u.info.copyright.empty()) s += ",\"copyright\":" + json_quote(u.info.copyright);
+		}
+
+		s += ",\"description\":" + json_quote(description) + ",\"usage\":" + json_quote(u.info.usage) + ",\"options\":[";
+
+		bool first = true;
+		for ( const auto& opt : u.options ) {
+			s += std::string(first ? "" : ",") + "{\"name\":" + json_quote(opt.first) + ",\"key\":" + json_quote(opt.second.key) +
+				",\"word\":" + json_quote(opt.second.word) + ",\"desc\":" + json_quote(opt.second.desc) +
+				",\"flag\":\"" + flags[opt.second.flag] + "\",\"type\":\"" + types[opt.second.type] + "\",\"arg\":" + json_quote(opt.second.name) + "}";
+			first = false;
+		}
+
+		s += "],\"positionals\":[";
+
+		first = true;
+		for ( const auto& p : u.positionals ) {
+			s += std::string(first ? "" : ",") + "{\"name\":" + json_quote(p.name) + ",\"desc\":" + json_quote(p.desc) +
+				",\"type\":\"" + types[p.type] + "\",\"variadic\":" + ( p.variadic ? "true" : "false" ) + "}";
+			first = false;
+		}
+
+		s += "],\"commands\":[";
+	}
+
+	return s;
+}
+
+// a command's part, rendered once per type, command line and depth (0: the
+// document is about it)
+static std::string part(const usage_t& u, const std::string& cmd, usage_t::doc_type type, size_t depth) {
+
+	if ( type == usage_t::doc_type::TEXT ) // help, kept by help_of()
+		return ( depth == 0 ? "" : "\n\n" ) + help_of(u, cmd, 0);
+
+	usage_t::help_cache_t& cache = usage_t::help_cache_t::of(u);
+
+	std::lock_guard<std::mutex> guard(cache.lock);
+	std::string& entry = cache.docs[std::string(doc_names[type]) + " " + std::to_string(depth) + " " + cmd];
+
+	if ( entry.empty())
+		entry = render(u, cmd, type, depth);
+
+	return entry;
+}
+
+static void tree(const usage_t& u, const std::string& cmd, usage_t::doc_type type, size_t depth, std::string& out) {
+
+	out += part(u, cmd, type, depth);
+
+	for ( size_t i = 0; i < u.commands.size(); i++ ) {
+
+		const std::string& name = u.commands[i].first;
+		std::string sub = join(cmd, name);
+		std::string shown = basename(sub);
+
+		if ( type == usage_t::doc_type::JSON && i != 0 )
+			out += ",";
+
+		if ( u.commands[i].second ) {
+			tree(*u.commands[i].second, sub, type, depth + 1, out);
+			continue;
+		}
+
+		// raw: its arguments are passed on as they are
+		if ( type == usage_t::doc_type::TEXT ) out += "\n\n" + sub + " [arguments..]";
+		else if ( type == usage_t::doc_type::MAN ) out += ".SS " + man_escape(shown) + "\n.B " + man_escape(shown) + "\n[arguments..]\n";
+		else if ( type == usage_t::doc_type::MARKDOWN ) out += "\n" + std::string(std::min<size_t>(6, depth + 2), '#') + " " + md_escape(shown) + "\n\n" + md_code(shown + " [arguments..]", true);
+		else if ( type == usage_t::doc_type::JSON ) out += "{\"name\":" + json_quote(name) + ",\"raw\":true}";
+	}
+
+	if ( type == usage_t::doc_type::JSON )
+		out += "]}";
+
+	if ( type == usage_t::doc_type::MAN && depth == 0 ) {
+		if ( !u.info.author.empty()) out += ".SH AUTHOR\n" + man_escape(u.info.author) + "\n";
+		if ( !u.info.copyright.empty()) out += ".SH COPYRIGHT\n" + man_escape(u.info.copyright) + "\n";
+	}
+}
+
+// the command at path and its command line; nullptr if there's none
+static const usage_t* find(const usage_t* node, const std::vector<std::string>& path, std::string& cmd) {
+
+	for ( const auto& name : path ) {
+
+		auto it = std::find_if(node -> commands.begin(), node -> commands.end(),
+			[&name](const auto& c) { return c.first == name; });
+
+		if ( it == node -> commands.end() || !it -> second )
+			return nullptr;
+
+		node = it -> second.get();
+		cmd = join(cmd, name);
+	}
+
+	return node;
+}
+
+std::string usage_t::help(const std::vector<std::string>& command, size_t width) const {
+
+	std::string cmd = this -> args.cmd();
+	const usage_t* node = find(this, command, cmd);
+
+	return node == nullptr ? "" : help_of(*node, cmd, width);
+}
+
+std::string usage_t::document(usage_t::doc_type type, const std::vector<std::string>& command) const {
+
+	std::string cmd = this -> args.cmd();
+	const usage_t* node = find(this, command, cmd);
+	std::string out;
+
+	if ( node == nullptr )
+		return out;
+
+	tree(*node, cmd, type, 0, out);
+
+	if ( type == usage_t::doc_type::TEXT || type == usage_t::doc_type::JSON )
+		out += "\n";
+
+	return out;
+}
+
+bool usage_t::exporting() const {
+
+	return this -> args.marker(export_marker);
+}
+
+std::string usage_t::document() const {
+
+	if ( !this -> exporting())
+		return "";
+
+	std::string format = this -> args._vec.size() > 1 ? this -> args._vec[1] : doc_names[0];
+
+	for ( size_t i = 0; i < sizeof(doc_names) / sizeof(doc_names[0]); i++ )
+		if ( format == doc_names[i] )
+			return this -> document((usage_t::doc_type)i, std::vector<std::string>(this -> args._vec.begin() + std::min<size_t>(2, this -> args._vec.size()), this -> args._vec.end()));
+
+	return "";
+}
@@ -0,0 +1,63 @@
+#include <atomic>
+
+#include "usage.hpp"
+
+// Readers and writers meet only at the atomic shared_ptr load/store of the
+// current schema; a schema stays alive as long as any snapshot of it does.
+
+// copy of a schema with its own commands tree, so that modifying the copy
+// never reaches a schema that readers may still hold - nor anything kept
+// with it: its dispatched command (a copy has a help cache of its own)
+std::shared_ptr<usage_t> usage_t::handle_t::clone(const usage_t& u) {
+
+	auto c = std::make_shared<usage_t>(u);
+
+	c -> validated.sub = nullptr;
+
+	for ( auto& cmd : c -> commands )
+		if ( cmd.second )
+			cmd.second = clone(*cmd.second);
+
+	return c;
+}
+
+usage_t::handle_t::handle_t(std::shared_ptr<const usage_t> schema) : _current(std::move(schema)) {}
+
+std::shared_ptr<const usage_t> usage_t::handle_t::snapshot() const {
+
+	return std::atomic_load(&this -> _current);
+}
+
+void usage_t::handle_t::replace(std::shared_ptr<const usage_t> schema) {
+
+	std::atomic_store(&this -> _current, std::move(schema));
+}
+
+void usage_t::handle_t::update(const std::function<void(usage_t& schema)>& modify) {
+
+	std::lock_guard<std::mutex> lock(this -> _writer);
+
+	auto current = this -> snapshot();
+	std::shared_ptr<usage_t> next = current ? clone(*current) : std::make_shared<usage_t>();
+
+	modify(*next);
+	this -> replace(std::move(next));
+}
+
+std::shared_ptr<const usage_t::parsed_t> usage_t::handle_t::parse(const std::vector<std::string>& args) const {
+
+	auto schema = this -> snapshot();
+
+	if ( !schema )
+		return std::make_shared<usage_t::parsed_t>();
+
+	// the result holds a snapshot: a replaced schema is released with the last
+	// of them
+	struct pinned_t {
+		std::shared_ptr<const usage_t> schema;
+		std::shared_ptr<const usage_t::parsed_t> result;
+	};
+
+	auto pinned = std::make_shared<pinned_t>(pinned_t{ schema, schema -> parse(args) });
+	return std::shared_ptr<const usage_t::parsed_t>(pinned, pinned -> result.get());
+}
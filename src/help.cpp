@@ -0,0 +1,290 @@
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#include "usage.hpp"
+#include "stats.hpp"
+#include "help.hpp"
+
+// columns a character starting at s[i] takes on a terminal, advancing i past it
+static size_t char_width(const std::string& s, size_t& i) {
+
+	unsigned char c = s[i];
+	uint32_t cp;
+	size_t len;
+
+	if ( c < 0x80 ) { i++; return 1; }
+	else if (( c & 0xe0 ) == 0xc0 ) { cp = c & 0x1f; len = 2; }
+	else if (( c & 0xf0 ) == 0xe0 ) { cp = c & 0x0f; len = 3; }
+	else if (( c & 0xf8 ) == 0xf0 ) { cp = c & 0x07; len = 4; }
+	else { i++; return 1; } // not a lead byte: shown as a replacement
+
+	size_t n = 1;
+	for ( ; n < len && i + n < s.size() && ( (unsigned char)s[i + n] & 0xc0 ) == 0x80; n++ )
+		cp = ( cp << 6 ) | ( (unsigned char)s[i + n] & 0x3f );
+	i += n;
+
+	if ( n < len )
+		return 1;
+
+	// combining marks and zero width characters
+	if (( cp >= 0x0300 && cp <= 0x036f ) || ( cp >= 0x200b && cp <= 0x200f ) || ( cp >= 0xfe00 && cp <= 0xfe0f ) ||
+		( cp >= 0x1ab0 && cp <= 0x1aff ) || ( cp >= 0x20d0 && cp <= 0x20ff ))
+		return 0;
+
+	// east asian wide and fullwidth, emoji
+	if (( cp >= 0x1100 && cp <= 0x115f ) || ( cp >= 0x2e80 && cp <= 0xa4cf && cp != 0x303f ) ||
+		( cp >= 0xac00 && cp <= 0xd7a3 ) || ( cp >= 0xf900 && cp <= 0xfaff ) || ( cp >= 0xfe30 && cp <= 0xfe4f ) ||
+		( cp >= 0xff00 && cp <= 0xff60 ) || ( cp >= 0xffe0 && cp <= 0xffe6 ) || ( cp >= 0x1f300 && cp <= 0x1f64f ) ||
+		( cp >= 0x1f900 && cp <= 0x1f9ff ) || ( cp >= 0x20000 && cp <= 0x3fffd ))
+		return 2;
+
+	return 1;
+}
+
+// display width of s: its size, unless it has anything but ASCII
+static size_t display_width(const std::string& s) {
+
+	bool ascii = true;
+	for ( unsigned char c : s )
+		if ( c >= 0x80 ) {
+			ascii = false;
+			break;
+		}
+
+	if ( ascii )
+		return s.size();
+
+	size_t w = 0;
+	for ( size_t i = 0; i < s.size(); )
+		w += char_width(s, i);
+	return w;
+}
+
+// text broken into lines of at most width columns, at spaces and at its own
+// line breaks; a word longer than width gets a line of its own
+static std::vector<std::string> wrap(const std::string& text, size_t width) {
+
+	std::vector<std::string> lines;
+	size_t start = 0;
+
+	do {
+		size_t end = text.find('\n', start);
+		std::string para = text.substr(start, end == std::string::npos ? std::string::npos : end - start);
+		std::string line;
+		size_t used = 0;
+
+		for ( size_t i = 0; i < para.size(); ) {
+
+			if ( para[i] == ' ' ) {
+				i++;
+				continue;
+			}
+
+			size_t j = para.find(' ', i);
+			std::string word = para.substr(i, j == std::string::npos ? std::string::npos : j - i);
+			size_t w = display_width(word);
+			i = j == std::string::npos ? para.size() : j;
+
+			if ( used != 0 && used + 1 + w > width ) {
+				lines.push_back(std::move(line));
+				line.clear();
+				used = 0;
+			}
+
+			if ( used != 0 ) {
+				line += ' ';
+				used++;
+			}
+
+			line += word;
+			used += w;
+		}
+
+		lines.push_back(std::move(line));
+		start = end == std::string::npos ? end : end + 1;
+
+	} while ( start != std::string::npos );
+
+	return lines;
+}
+
+static std::string pad(std::string s, size_t width) {
+
+	for ( size_t w = display_width(s); w < width; w++ )
+		s += ' ';
+	return s;
+}
+
+// help, descriptions wrapped to width (0: not wrapped)
+static std::string render(const usage_t& u, const std::string& cmd, size_t width) {
+
+	if ( u.options.empty())
+		return "No options available for this program";
+
+	size_t ks = 0;
+	std::string s;
+
+	if ( !u.info.usage_title.empty() || !u.info.usage.empty()) {
+
+		if ( !u.info.usage_title.empty())
+			s += u.info.usage_title;
+
+		s += cmd;
+
+		if ( !u.info.usage.empty())
+			s += " " + u.info.usage;
+
+		s += "\n";
+	}
+
+	if ( !u.info.description.empty())
+		s += u.info.description;
+
+	if ( !u.info.options_title.empty())
+		s += u.info.options_title;
+
+	// find size of shortest key
+	for ( auto it = u.options.begin(); it != u.options.end(); it++ ) {
+
+		if ( it -> first.empty() || ( it -> second.key.empty() && it -> second.word.empty()))
+			continue;
+
+		if ( !it -> second.key.empty() && ks < ( it -> second.key.size() + 1 ))
+			ks = it -> second.key.size() + 1;
+	}
+
+	// Build each option's left part (everything up to the description), measure
+	// the widest, then align every description to a common column. (Computing a
+	// width up front mis-counted the key-column padding, so long options ran into
+	// their descriptions.)
+	std::vector<std::pair<std::string, std::string>> rows;   // { left part, description }
+	size_t widest = 0;
+
+	for ( auto it = u.options.begin(); it != u.options.end(); it++ ) {
+
+		if ( it -> first.empty() || ( it -> second.key.empty() && it -> second.word.empty()))
+			continue;
+
+		std::string row = "   ";
+
+		if ( !it -> second.key.empty()) {
+
+			row += "-" + it -> second.key;
+			if ( !it -> second.word.empty())
+				row += ", ";
+
+			while ( row.size() < ks + 5 )
+				row += " ";
+
+		} else while ( row.size() < ks + 5 )
+			row += ' ';
+
+		if ( !it -> second.word.empty())
+			row += "--" + it -> second.word;
+
+		if ( it -> second.flag == usage_t::arg_flag::REQUIRED )
+			row += " <" + ( it -> second.name.empty() ? "arg" : it -> second.name ) + ">";
+		else if ( it -> second.flag == usage_t::arg_flag::OPTIONAL )
+			row += " [" + ( it -> second.name.empty() ? "arg" : it -> second.name ) + "]";
+
+		if ( size_t w = display_width(row); w > widest )
+			widest = w;
+
+		rows.push_back({ row, it -> second.desc });
+	}
+
+	// descriptions start 3 columns after the widest option; when that leaves
+	// them too little room, they go below their option, indented
+	size_t column = widest + 3;
+	bool below = width != 0 && width < column + 20;
+	size_t indent = below ? 8 : column;
+	size_t room = width > indent ? width - indent : 0;
+
+	for ( const auto& r : rows ) {
+
+		if ( !s.empty())
+			s += '\n';
+
+		if ( r.second.empty()) {
+			s += r.first;
+			continue;
+		}
+
+		if ( width == 0 ) {
+			s += pad(r.first, widest) + "   " + r.second;   // gap between the option column and its description
+			continue;
+		}
+
+		std::vector<std::string> lines = wrap(r.second, room < 10 ? std::string::npos : room);
+
+		if ( below )
+			s += r.first + "\n" + std::string(indent, ' ') + lines.front();
+		else s += pad(r.first, widest) + "   " + lines.front();
+
+		for ( size_t i = 1; i < lines.size(); i++ )
+			s += "\n" + std::string(indent, ' ') + lines[i];
+	}
+
+	if ( !u.info.footer.empty())
+		s += "\n" + u.info.footer;
+
+	return s;
+}
+
+std::string usage_t::help() const {
+
+	USAGE_STAT(usage_stat_timer_t _help_timer(usage_t::stats().help));
+
+	return render(*this, this -> args.cmd(), 0);
+}
+
+std::string help_of(const usage_t& u, const std::string& cmd, size_t width) {
+
+	USAGE_STAT(usage_stat_timer_t _help_timer(usage_t::stats().help));
+
+	usage_t::help_cache_t& cache = usage_t::help_cache_t::of(u);
+	std::lock_guard<std::mutex> guard(cache.lock);
+
+	auto it = cache.by_width.find(width);
+
+	if ( it != cache.by_width.end() && it -> second.first == cmd )
+		return it -> second.second;
+
+	if ( it == cache.by_width.end() && cache.by_width.size() >= usage_t::help_cache_t::max_widths )
+		cache.by_width.clear();
+
+	auto& entry = cache.by_width[width];
+	entry = { cmd, render(u, cmd, width) };
+	return entry.second;
+}
+
+void usage_t::invalidate_help() const {
+
+	if ( std::shared_ptr<usage_t::help_cache_t> cache = std::atomic_load(&this -> help_cache.ptr); cache ) {
+
+		std::lock_guard<std::mutex> guard(cache -> lock);
+		cache -> by_width.clear();
+		cache -> docs.clear();
+	}
+}
+
+std::string usage_t::help(size_t width) const {
+
+	return help_of(*this, this -> args.cmd(), width);
+}
+
+size_t usage_t::terminal_width(int fd) {
+
+	struct winsize ws;
+
+	if ( ioctl(fd, TIOCGWINSZ, &ws) == 0 && ws.ws_col != 0 )
+		return ws.ws_col;
+
+	if ( const char* columns = std::getenv("COLUMNS"); columns != nullptr )
+		return std::strtoul(columns, nullptr, 10);
+
+	return 0;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <string>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <unordered_map>
+
+#include "usage.hpp"
+
+// Rendered help and documents of one usage_t, kept in usage_t::help_cache
+// (help.cpp, document.cpp).
+
+// Renderings are kept until usage_t::invalidate_help() drops them - merge()
+// does, an edit in place has to.
+struct usage_t::help_cache_t {
+
+	// widths kept at once; one more starts over (a terminal being resized)
+	static constexpr size_t max_widths = 8;
+
+	std::mutex lock;
+	std::unordered_map<size_t, std::pair<std::string, std::string>> by_width;   // command line and help
+	std::unordered_map<std::string, std::string> docs;   // by type, depth and command line
+
+	// u's cache, created on first use - help may be asked from several threads
+	static help_cache_t& of(const usage_t& u) {
+
+		std::shared_ptr<help_cache_t> cache = std::atomic_load(&u.help_cache.ptr);
+
+		if ( !cache ) {
+			auto created = std::make_shared<help_cache_t>();
+			cache = std::atomic_compare_exchange_strong(&u.help_cache.ptr, &cache, created) ? created : cache;
+		}
+
+		return *cache;
+	}
+};
+
+// help of u as run by the command line cmd, wrapped to width (0: not wrapped);
+// rendered once per width, while cmd stays the same
+std::string help_of(const usage_t& u, const std::string& cmd, size_t width);
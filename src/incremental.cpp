@@ -0,0 +1,180 @@
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+
+#include "usage.hpp"
+#include "parser.hpp"
+
+// what the parser met, in order
+struct event_t {
+
+	enum kind_t { OPTION, POSITIONAL, COMMAND, ERROR };
+
+	kind_t kind;
+	const usage_t* u;                    // met parsing this usage_t (a command's own)
+	int idx = -1;                        // option or command
+	size_t pos = 0;                      // command's position
+	std::string value;                   // option's value, positional, command's name
+	usage_t::error_ref_t error = {};
+};
+
+// the parser as it was before an argument
+struct checkpoint_t {
+	bool set = false;
+	const usage_t* u = nullptr;
+	size_t events = 0;
+	parse_state_t state;
+};
+
+struct usage_t::incremental_t::state_t {
+
+	const usage_t* schema;
+	std::vector<std::string> args;
+	std::vector<event_t> events;
+	std::vector<checkpoint_t> checkpoints;   // by argument; [args.size()]: before the end
+	std::shared_ptr<const usage_t::parsed_t> result;
+	size_t reparsed = 0;
+
+	// records events and checkpoints, following commands into their own options
+	struct sink_t {
+
+		static constexpr bool binds = false;
+		static constexpr bool checkpoints = true;
+
+		state_t* s;
+		const usage_t* u;
+
+		void option(int idx, std::string&& value) {
+			this -> s -> events.push_back({ .kind = event_t::OPTION, .u = this -> u, .idx = idx, .value = std::move(value) });
+		}
+
+		void positional(std::string&& arg) {
+			this -> s -> events.push_back({ .kind = event_t::POSITIONAL, .u = this -> u, .value = std::move(arg) });
+		}
+
+		void error(const usage_t::error_ref_t& e) {
+			this -> s -> events.push_back({ .kind = event_t::ERROR, .u = this -> u, .error = e });
+		}
+
+		void command(size_t pos, const std::string& name, int c) {
+
+			this -> s -> events.push_back({ .kind = event_t::COMMAND, .u = this -> u, .idx = c, .pos = pos, .value = name });
+
+			if ( const usage_t* target = this -> u -> commands[c].second.get(); target != nullptr ) {
+
+				const usage_t* parent = this -> u;
+				this -> u = target;
+				parse_args(usage_view_t{ target }, this -> s -> args, pos + 1, *this);
+				this -> u = parent;
+			}
+		}
+
+		void checkpoint(size_t pos, const parse_state_t& state) {
+			this -> s -> checkpoints[pos] = { .set = true, .u = this -> u, .events = this -> s -> events.size(), .state = state };
+		}
+	};
+
+	// the result, from the events - as parse(args) builds it
+	std::shared_ptr<const usage_t::parsed_t> build() const {
+
+		auto result = std::make_shared<usage_t::parsed_t>();
+		usage_t::parsed_t* p = result.get();
+
+		// each usage_t met and its result, for their positional slots
+		std::vector<std::pair<const usage_t*, usage_t::parsed_t*>> levels = {{ this -> schema, p }};
+
+		for ( const auto& e : this -> events ) {
+
+			if ( e.kind == event_t::OPTION )
+				p -> values[e.u -> options[e.idx].first] = e.value;
+			else if ( e.kind == event_t::POSITIONAL )
+				p -> remainder.push_back(e.value);
+			else if ( e.kind == event_t::ERROR ) {
+
+				if ( e.error.error == usage_t::error_type::ARG_VALIDATION || e.error.error == usage_t::error_type::MISSING_ARG )
+					p -> values.erase(e.u -> options[e.error.option].first);
+
+				p -> errors.push_back(make_error(usage_view_t{ e.u }, this -> args, e.error));
+
+			} else if ( e.kind == event_t::COMMAND ) {
+
+				p -> command = e.value;
+				p -> tail.assign(this -> args.begin() + e.pos + 1, this -> args.end());
+
+				if ( e.u -> commands[e.idx].second ) {
+					auto sub = std::make_shared<usage_t::parsed_t>();
+					p -> sub = sub;
+					p = sub.get();
+					levels.push_back({ e.u -> commands[e.idx].second.get(), p });
+				}
+			}
+		}
+
+		for ( const auto& level : levels ) {
+
+			parsed_sink_t<usage_view_t> sink = { .u = usage_view_t{ level.first }, .p = level.second, .args = this -> args };
+
+			if ( level.second -> command.empty())
+				parse_positionals(sink.u, level.second -> remainder, sink);
+
+			parsed_sink_t<usage_view_t>::fallbacks(sink.u, level.second);
+		}
+
+		return result;
+	}
+};
+
+usage_t::incremental_t::incremental_t(const usage_t& schema) : _state(std::make_shared<state_t>()) {
+
+	this -> _state -> schema = &schema;
+}
+
+std::shared_ptr<const usage_t::parsed_t> usage_t::incremental_t::parse(const std::vector<std::string>& args) {
+
+	USAGE_STAT(usage_stat_timer_t _parse_timer(usage_t::stats().parse));
+
+	state_t& s = *this -> _state;
+
+	// the first changed argument: everything before it parses as it did
+	size_t changed = 0;
+	while ( changed < args.size() && changed < s.args.size() && args[changed] == s.args[changed] )
+		changed++;
+
+	if ( s.result && changed == args.size() && changed == s.args.size()) {
+		s.reparsed = 0;
+		return s.result;
+	}
+
+	// resume from the nearest checkpoint at or before it - arguments of a raw
+	// command have none, parsing goes back to the command then
+	size_t first = std::min(changed, s.checkpoints.empty() ? 0 : s.checkpoints.size() - 1);
+	while ( first > 0 && !s.checkpoints[first].set )
+		first--;
+
+	checkpoint_t from = first < s.checkpoints.size() && s.checkpoints[first].set ? std::move(s.checkpoints[first]) :
+		checkpoint_t{ .set = true, .u = s.schema, .state = { .seen = std::vector<bool>(s.schema -> options.size()) }};
+
+	s.events.erase(s.events.begin() + from.events, s.events.end());
+	s.checkpoints.resize(first);
+	s.checkpoints.resize(args.size() + 1);
+	s.args = args;
+
+	state_t::sink_t sink = { .s = &s, .u = from.u };
+	parse_args(usage_view_t{ from.u }, s.args, first, sink, from.state);
+
+	s.reparsed = args.size() - first;
+	s.result = s.build();
+	return s.result;
+}
+
+size_t usage_t::incremental_t::reparsed() const {
+	return this -> _state -> reparsed;
+}
+
+void usage_t::incremental_t::clear() {
+
+	const usage_t* schema = this -> _state -> schema;
+	*this -> _state = state_t();
+	this -> _state -> schema = schema;
+}
@@ -0,0 +1,191 @@
+#include <string>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+#include "usage.hpp"
+#include "parser.hpp"
+
+static constexpr size_t block_size = 65536;    // read at once (grows for longer lines)
+static constexpr size_t flush_size = 65536;    // output is written once this large
+
+static void write_all(int fd, std::string& buf) {
+
+	for ( size_t done = 0; done < buf.size(); ) {
+
+		ssize_t n = ::write(fd, buf.data() + done, buf.size() - done);
+
+		if ( n < 0 && errno == EINTR )
+			continue;
+		if ( n <= 0 )
+			break;
+
+		done += n;
+	}
+
+	buf.clear();
+}
+
+// splits [p, end) into words in place - quotes and backslashes are dropped by
+// moving the rest of the word down - as { start, length } spans; returns how many
+static size_t split(char* p, char* end, std::vector<std::pair<const char*, size_t>>& spans) {
+
+	size_t n = 0;
+
+	while ( p < end ) {
+
+		while ( p < end && std::isspace((unsigned char)*p))
+			p++;
+
+		if ( p == end || *p == '#' )
+			break;
+
+		char* start = p;
+		char* w = p;
+		char quote = 0;
+
+		for ( ; p < end; p++ ) {
+
+			char c = *p;
+
+			if ( quote == 0 && std::isspace((unsigned char)c))
+				break;
+
+			if ( quote == 0 && ( c == '\'' || c == '"' )) {
+				quote = c;
+				continue;
+			}
+
+			if ( quote != 0 && c == quote ) {
+				quote = 0;
+				continue;
+			}
+
+			if ( c == '\\' && quote != '\'' && p + 1 < end )
+				c = *++p;
+
+			*w++ = c;
+		}
+
+		if ( n == spans.size())
+			spans.emplace_back();
+		spans[n++] = { start, (size_t)( w - start ) };
+	}
+
+	return n;
+}
+
+size_t usage_t::loop_t::run(int in, int out) const {
+
+	std::vector<char> buf(block_size);
+	size_t len = 0;
+	size_t lines = 0;
+	bool eof = false;
+
+	// reused from line to line: their storage stays allocated
+	std::string output;
+	std::vector<std::pair<const char*, size_t>> spans;
+	std::vector<std::string> words;
+	usage_t::parsed_t result;
+
+	while ( !eof ) {
+
+		// a line longer than the buffer
+		if ( len == buf.size())
+			buf.resize(buf.size() * 2);
+
+		// all input so far is handled: its output goes before waiting for more
+		if ( !output.empty())
+			write_all(out, output);
+
+		ssize_t n = ::read(in, buf.data() + len, buf.size() - len);
+
+		if ( n < 0 && errno == EINTR )
+			continue;
+
+		if ( n <= 0 ) eof = true; // the last line may lack its newline
+		else len += n;
+
+		char* p = buf.data();
+		char* end = p + len;
+
+		while ( p < end ) {
+
+			char* nl = (char*)std::memchr(p, '\n', end - p);
+
+			if ( nl == nullptr && !eof )
+				break;
+
+			char* e = nl == nullptr ? end : nl;
+			char* next = nl == nullptr ? end : nl + 1;
+
+			if ( e > p && e[-1] == '\r' )
+				e--;
+
+			size_t count = split(p, e, spans);
+			p = next;
+
+			if ( count == 0 )
+				continue;
+
+			words.resize(count);
+			for ( size_t i = 0; i < count; i++ )
+				words[i].assign(spans[i].first, spans[i].second);
+
+			result.values.clear();
+			result.errors.clear();
+			result.remainder.clear();
+			result.command.clear();
+			result.sub.reset();
+			result.tail.clear();
+			result.variadic.reset();
+			result.fallbacks.reset();
+
+			parsed_sink_t<usage_view_t>::parse(usage_view_t{ this -> schema }, words, 0, &result);
+			lines++;
+
+			// an error in a subcommand fails the line as one at the root does
+			if ( result.error_count() != 0 ) {
+
+				if ( this -> error )
+					this -> error(result, output);
+				else {
+					std::ostringstream os;
+					os << words.front() << ":";
+
+					// each level's errors explained by its own usage_t
+					const usage_t* owner = this -> schema;
+
+					for ( const usage_t::parsed_t* level = &result; level != nullptr; level = level -> sub.get()) {
+
+						if ( !level -> errors.empty())
+							os << owner -> explain(level -> errors);
+
+						if ( level -> sub != nullptr )
+							owner = std::find_if(owner -> commands.begin(), owner -> commands.end(),
+								[level](const auto& c) { return c.first == level -> command; }) -> second.get();
+					}
+
+					output += os.str() + "\n";
+				}
+
+			} else if ( auto it = this -> commands.find(result.command); it != this -> commands.end() && it -> second )
+				it -> second(result, output);
+
+			if ( output.size() >= flush_size )
+				write_all(out, output);
+		}
+
+		// keep the incomplete last line for the next read
+		len = end - p;
+		std::memmove(buf.data(), p, len);
+	}
+
+	write_all(out, output);
+	return lines;
+}
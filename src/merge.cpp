@@ -0,0 +1,93 @@
+#include <unordered_map>
+
+#include "usage.hpp"
+
+// where each name, key/word and command was declared: index of the module
+// in merge(), or own for this usage_t's existing entries
+static const size_t own = SIZE_MAX;
+
+std::vector<usage_t::conflict_t> usage_t::merge(const std::vector<usage_t::module_t>& modules) {
+
+	size_t options = this -> options.size();
+	size_t commands = this -> commands.size();
+
+	for ( const auto& m : modules ) {
+		options += m.options.size();
+		commands += m.commands.size();
+	}
+
+	std::unordered_map<std::string, size_t> names, spellings, command_names;
+	names.reserve(options);
+	spellings.reserve(options * 2);
+	command_names.reserve(commands);
+
+	for ( const auto& opt : this -> options ) {
+		names.emplace(opt.first, own);
+		if ( !opt.second.key.empty()) spellings.emplace(opt.second.key, own);
+		if ( !opt.second.word.empty()) spellings.emplace(opt.second.word, own);
+	}
+
+	for ( const auto& c : this -> commands )
+		command_names.emplace(c.first, own);
+
+	this -> options.reserve(options);
+	this -> commands.reserve(commands);
+
+	std::vector<usage_t::conflict_t> conflicts;
+
+	auto module_name = [&modules](size_t m) {
+		return m == own ? std::string() : modules[m].name;
+	};
+
+	auto clash = [&conflicts, &module_name](const char* what, const std::string& value, size_t first, size_t again) {
+		conflicts.push_back({ .what = what, .value = value, .module = module_name(first), .other = module_name(again) });
+	};
+
+	for ( size_t m = 0; m < modules.size(); m++ ) {
+
+		for ( const auto& opt : modules[m].options ) {
+
+			const std::string& key = opt.second.key;
+			const std::string& word = opt.second.word;
+			bool ok = true;
+
+			if ( auto it = names.find(opt.first); it != names.end()) {
+				clash("name", opt.first, it -> second, m);
+				ok = false;
+			}
+
+			if ( auto it = key.empty() ? spellings.end() : spellings.find(key); it != spellings.end()) {
+				clash("key", key, it -> second, m);
+				ok = false;
+			}
+
+			if ( auto it = word.empty() ? spellings.end() : spellings.find(word); it != spellings.end()) {
+				clash("word", word, it -> second, m);
+				ok = false;
+			}
+
+			if ( !ok )
+				continue;
+
+			names.emplace(opt.first, m);
+			if ( !key.empty()) spellings.emplace(key, m);
+			if ( !word.empty()) spellings.emplace(word, m);
+			this -> options.push_back(opt);
+		}
+
+		for ( const auto& c : modules[m].commands ) {
+
+			if ( auto [it, added] = command_names.emplace(c.first, m); !added ) {
+				clash("command", c.first, it -> second, m);
+				continue;
+			}
+
+			this -> commands.push_back(c);
+		}
+	}
+
+	this -> validated = usage_t::validator_t(this);
+	this -> invalidate_help();
+	std::atomic_store(&this -> fallback_index.ptr, std::shared_ptr<const usage_t::fallbacks_t>());
+	return conflicts;
+}
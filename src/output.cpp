@@ -0,0 +1,287 @@
+#include <string>
+#include <vector>
+#include <sstream>
+#include <unordered_map>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "usage.hpp"
+#include "util.hpp"
+
+// Parse results for shell scripts: `eval "$(prog __parse sh "$@")"`, or read
+// as NUL terminated records, or as JSON.
+
+static const std::string parse_marker = "__parse";
+
+// 'single quoted', safe to eval
+static std::string sh_quote(const std::string& s) {
+
+	std::string r = "'";
+
+	for ( char c : s ) {
+		if ( c == '\'' ) r += "'\\''";
+		else r += c;
+	}
+
+	return r + "'";
+}
+
+// part of a shell variable name: anything but letters and digits becomes _,
+// never two in a row nor at either end - the fixed variables, which have a __
+// (usage__errors, usage_<command>__errors, ..), are never taken by a value
+static std::string sh_name(const std::string& s) {
+
+	std::string r;
+
+	for ( unsigned char c : s ) {
+		if ( std::isalnum(c)) r += (char)c;
+		else if ( !r.empty() && r.back() != '_' ) r += '_';
+	}
+
+	if ( !r.empty() && r.back() == '_' )
+		r.pop_back();
+	return r;
+}
+
+// a number as JSON has it - no leading zeros, digits on both sides of a
+// point; quoted if it does not fit int64_t / double
+static std::string json_number(const std::string& v, usage_t::arg_type type) {
+
+	const char* s = v.c_str();
+	char* end = nullptr;
+	errno = 0;
+
+	if ( type == usage_t::arg_type::INT ) {
+
+		long long l = std::strtoll(s, &end, 10);
+		return end == s || *end != 0 || errno != 0 ? json_quote(v) : std::to_string(l);
+	}
+
+	double d = std::strtod(s, &end);
+
+	if ( end == s || *end != 0 || errno != 0 || !std::isfinite(d))
+		return json_quote(v);
+
+	// the shortest that reads back as the same double
+	char buf[32];
+	for ( int precision = 15; precision <= 17; precision++ ) {
+		std::snprintf(buf, sizeof(buf), "%.*g", precision, d);
+		if ( std::strtod(buf, nullptr) == d )
+			break;
+	}
+
+	return buf;
+}
+
+// an error as it is printed, without the leading space
+static std::string message(const usage_t::error_t& e) {
+
+	std::ostringstream os;
+	os << std::vector<usage_t::error_t>{ e };
+	return os.str().substr(1);
+}
+
+// a value as given and its JSON form: numbers and booleans as such, flags true
+struct typed_t {
+	std::string name;
+	std::string value;
+	std::string json;
+};
+
+static std::vector<typed_t> typed(const usage_t& u) {
+
+	std::vector<typed_t> v;
+
+	auto add = [&u, &v](const std::string& name, usage_t::arg_type type, bool flag) {
+
+		if ( !u.contains(name))
+			return;
+
+		std::string value = u.value(name);
+		std::string json;
+
+		if ( flag ) value = "true";
+
+		if ( flag || type == usage_t::arg_type::BOOL ) json = value.empty() ? "null" : value;
+		else if (( type == usage_t::arg_type::INT || type == usage_t::arg_type::FLOAT ) && !value.empty()) json = json_number(value, type);
+		else json = json_quote(value);
+
+		v.push_back({ .name = name, .value = std::move(value), .json = std::move(json) });
+	};
+
+	// in declared order: options, then positional slots
+	for ( const auto& opt : u.options )
+		add(opt.first, opt.second.type, opt.second.flag == usage_t::arg_flag::NO);
+
+	for ( const auto& p : u.positionals )
+		if ( !p.variadic )
+			add(p.name, p.type, false);
+
+	return v;
+}
+
+// the result so far: shell variables by what they hold, and errors reported
+struct rendered_t {
+	std::unordered_map<std::string, std::string> taken;
+	size_t errors = 0;
+};
+
+// one usage_t's part of the result; prefix: the command path, for sh (its
+// variable name parts, each followed by _) and nul
+static void render(const usage_t& u, const std::string& format, const std::string& prefix, std::string& out, rendered_t& state) {
+
+	std::vector<typed_t> values = typed(u);
+	std::vector<usage_t::error_t> errors = u.errors();
+	std::vector<std::string> remainder = u.remainder();
+	std::string command = u.subcommand();
+	const usage_t* sub = u.sub();
+
+	if ( format == "sh" ) {
+
+		std::vector<std::string> messages;
+
+		for ( const auto& e : errors )
+			messages.push_back(message(e));
+
+		// names that map to a variable taken already (foo-bar, foo_bar; an
+		// option and a command's option) are left out and reported
+		for ( const auto& v : values ) {
+
+			std::string name = "usage_" + prefix + sh_name(v.name);
+
+			if ( auto [it, added] = state.taken.emplace(name, v.name); !added ) {
+				messages.push_back("--" + v.name + ": shell variable " + name + " is taken by --" + it -> second);
+				continue;
+			}
+
+			out += name + "=" + sh_quote(v.value) + "\n";
+		}
+
+		state.errors += messages.size();
+		out += "usage_" + prefix + "_errors=" + std::to_string(messages.size()) + "\n";
+
+		for ( size_t i = 0; i < messages.size(); i++ )
+			out += "usage_" + prefix + "_error_" + std::to_string(i + 1) + "=" + sh_quote(messages[i]) + "\n";
+
+		if ( !command.empty())
+			out += "usage_" + prefix + "_command=" + sh_quote(command) + "\n";
+
+		// the positional parameters: the remainder where parsing ended - a raw
+		// command's arguments, as they are
+		if ( sub != nullptr )
+			render(*sub, format, prefix + sh_name(command) + "_", out, state);
+		else {
+			std::vector<std::string> args = command.empty() ? remainder : u.tail();
+
+			out += "set --";
+			for ( const auto& a : args )
+				out += " " + sh_quote(a);
+			out += "\n";
+		}
+
+	} else if ( format == "nul" ) {
+
+		for ( const auto& v : values )
+			out += "value:" + prefix + v.name + "=" + v.value + '\0';
+
+		for ( const auto& a : remainder )
+			out += "arg:" + prefix + a + '\0';
+
+		for ( const auto& e : errors )
+			out += "error:" + prefix + message(e) + '\0';
+
+		if ( !command.empty())
+			out += "command:" + prefix + command + '\0';
+
+		if ( sub != nullptr )
+			render(*sub, format, prefix + command + ".", out, state);
+		else if ( !command.empty())
+			for ( const auto& a : u.tail())
+				out += "tail:" + prefix + command + "=" + a + '\0';
+
+	} else if ( format == "json" ) {
+
+		out += "{\"values\":{";
+		for ( size_t i = 0; i < values.size(); i++ )
+			out += ( i == 0 ? "" : "," ) + json_quote(values[i].name) + ":" + values[i].json;
+
+		out += "},\"remainder\":[";
+		for ( size_t i = 0; i < remainder.size(); i++ )
+			out += ( i == 0 ? "" : "," ) + json_quote(remainder[i]);
+
+		out += "],\"errors\":[";
+		for ( size_t i = 0; i < errors.size(); i++ )
+			out += ( i == 0 ? "" : "," ) + json_quote(message(errors[i]));
+		out += "]";
+
+		if ( !command.empty()) {
+
+			out += ",\"command\":" + json_quote(command);
+
+			if ( sub != nullptr ) {
+				out += ",\"sub\":";
+				render(*sub, format, "", out, state);
+			} else {
+				std::vector<std::string> tail = u.tail();
+
+				out += ",\"tail\":[";
+				for ( size_t i = 0; i < tail.size(); i++ )
+					out += ( i == 0 ? "" : "," ) + json_quote(tail[i]);
+				out += "]";
+			}
+		}
+
+		out += "}";
+	}
+}
+
+std::string usage_t::result(const std::string& format) const {
+
+	std::string out;
+	rendered_t state;
+
+	render(*this, format, "", out, state);
+
+	// eval's status is its last command's: a failing one when there were
+	// errors, so that `eval "$(prog __parse sh "$@")" || exit 1` exits
+	if ( format == "sh" && state.errors != 0 )
+		out += "false\n";
+
+	if ( format == "json" )
+		out += "\n";
+
+	return out;
+}
+
+bool usage_t::write_result(const std::string& format, int fd) const {
+
+	std::string out = this -> result(format);
+
+	for ( size_t done = 0; done < out.size(); ) {
+
+		ssize_t n = ::write(fd, out.data() + done, out.size() - done);
+
+		if ( n < 0 && errno == EINTR )
+			continue;
+		if ( n <= 0 )
+			return false;
+
+		done += n;
+	}
+
+	return !out.empty();
+}
+
+bool usage_t::scripting() const {
+
+	return this -> args.marker(parse_marker);
+}
+
+std::string usage_t::format() const {
+
+	return this -> scripting() && this -> args._vec.size() > 1 ? this -> args._vec[1] : "";
+}
@@ -0,0 +1,751 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <array>
+#include <memory>
+#include <algorithm>
+
+#include "usage.hpp"
+#include "stats.hpp"
+
+// The parser, shared by validator.cpp (usage_t) and schema.cpp (compiled
+// schemas): argument helpers, the usage_t schema view and parse_args().
+
+static const std::string whitespace = " \t\n\r\f\v";
+
+static inline std::string l_trim(const std::string& str) {
+
+	std::string _str(str);
+	_str.erase(_str.find_last_not_of(whitespace) + 1);
+	return _str;
+}
+
+static inline std::string trim(const std::string& str) {
+
+	std::string _str(l_trim(str));
+	_str.erase(0, _str.find_first_not_of(whitespace));
+	return _str;
+}
+
+static inline std::string to_lower(const std::string& str) {
+
+	std::string _str(str);
+
+	for ( auto& ch : _str )
+		if ( std::isupper(ch))
+			ch ^= 32;
+	return _str;
+}
+
+static inline bool has_prefix(const std::string& str, const std::string& prefix) {
+
+	#if __cplusplus >= 202002L
+		return str.starts_with(prefix);
+	#else
+		return str.size() >= prefix.size() && str.substr(0, prefix.size()).compare(prefix) == 0;
+	#endif
+}
+
+static inline bool is_number(const std::string& s) {
+
+	return !s.empty() && s.find_first_not_of("1234567890") == std::string::npos;
+}
+
+static inline bool is_float(const std::string& s) {
+
+	if ( s.empty() || s.find_first_not_of("1234567890.") != std::string::npos || s.find_first_of("1234567890") == std::string::npos )
+		return false;
+
+	if ( s.find_first_of('.') == std::string::npos )
+		return true;
+
+	return std::count_if(s.begin(), s.end(), [](std::string::value_type ch) { return ch == '.'; }) < 2;
+}
+
+static inline bool is_hex(const std::string& s) {
+
+	return ( has_prefix(s, "0x") && s.size() > 2 &&
+		s.find_first_not_of("01234567890abcdefABCDEF", 2) == std::string::npos ) ||
+		( !s.empty() && s.find_first_not_of("01234567890abcdefABCDEF") == std::string::npos );
+}
+
+// checks an option's argument against its type, normalising it in place
+// (trimmed; hex as 0x..., bool as true/false) - left as is, if not valid
+static inline bool check_value(usage_t::arg_type type, std::string& v) {
+
+	if ( type == usage_t::arg_type::STRING )
+		return true;
+
+	v = trim(v);
+
+	if ( type == usage_t::arg_type::INT )
+		return is_number(v);
+	else if ( type == usage_t::arg_type::FLOAT )
+		return is_float(v);
+	else if ( type == usage_t::arg_type::HEX ) {
+
+		std::string h(v);
+
+		if ( h.size() > 1 && h.front() == '#' && std::isdigit(h.at(1))) {
+			h.erase(0, 1);
+			h = "0x" + h;
+		} else if ( h.size() > 1 && h.front() == 'x' )
+			h = "0" + h;
+		else if ( !has_prefix(h, "0x"))
+			h = "0x" + h;
+
+		if ( !is_hex(h))
+			return false;
+
+		v = h;
+
+	} else if ( type == usage_t::arg_type::BOOL ) {
+
+		std::string b(to_lower(v));
+		if ( b == "0" || b == "no" || b == "disabled" ) b = "false";
+		else if ( b == "1" || b == "yes" || b == "enabled" ) b = "true";
+
+		if ( b != "false" && b != "true" )
+			return false;
+
+		v = b;
+	}
+
+	return true;
+}
+
+// the schema view of a usage_t: its options and commands, as declared, found
+// by a linear scan. A null usage_t is a raw passthrough command.
+struct usage_view_t {
+
+	const usage_t* u;
+
+	explicit operator bool() const { return this -> u != nullptr; }
+
+	size_t size() const { return this -> u -> options.size(); }
+
+	int find(const std::string& name) const {
+
+		for ( size_t i = 0; i < this -> u -> options.size(); i++ )
+			if ( name == this -> u -> options[i].second.key || name == this -> u -> options[i].second.word )
+				return (int)i;
+		return -1;
+	}
+
+	const std::string& name(size_t i) const { return this -> u -> options[i].first; }
+	const std::string& key(size_t i) const { return this -> u -> options[i].second.key; }
+	const std::string& word(size_t i) const { return this -> u -> options[i].second.word; }
+	usage_t::arg_flag flag(size_t i) const { return this -> u -> options[i].second.flag; }
+	usage_t::arg_type type(size_t i) const { return this -> u -> options[i].second.type; }
+	const usage_t::bind_t* bind(size_t i) const { return &this -> u -> options[i].second.bind; }
+	std::shared_ptr<const usage_t::fallbacks_t> fallbacks() const { return this -> u -> fallbacks(); }
+
+	int command(const std::string& name) const {
+
+		for ( size_t i = 0; i < this -> u -> commands.size(); i++ )
+			if ( name == this -> u -> commands[i].first )
+				return (int)i;
+		return -1;
+	}
+
+	usage_view_t child(int c) const { return { this -> u -> commands[c].second.get() }; }
+	size_t commands() const { return this -> u -> commands.size(); }
+	const std::string& command_name(size_t c) const { return this -> u -> commands[c].first; }
+
+	size_t positionals() const { return this -> u -> positionals.size(); }
+	const std::string& positional_name(size_t i) const { return this -> u -> positionals[i].name; }
+	usage_t::arg_type positional_type(size_t i) const { return this -> u -> positionals[i].type; }
+	bool positional_variadic(size_t i) const { return this -> u -> positionals[i].variadic; }
+};
+
+// Bounded edit distance against one mistyped name, bit-parallel (Myers/Hyyrö):
+// the name's character masks are built once and reused for every candidate,
+// each candidate costs one pass of a few word ops per character and is dropped
+// as soon as it can no longer come within the bound.
+class suggester_t {
+
+	private:
+		uint64_t peq[256] = {};
+		uint64_t last = 0;
+		size_t m;
+
+	public:
+		size_t bound;
+
+		suggester_t(const std::string& name) : m(name.size()) {
+
+			// shorter names tolerate fewer edits: none for 1 char, 1 up to 4
+			// chars, 2 up to 7, at most 3
+			this -> bound = name.size() > 64 ? 0 : std::min<size_t>(3, ( name.size() + 1 ) / 3);
+
+			if ( this -> bound == 0 )
+				return;
+
+			for ( size_t i = 0; i < this -> m; i++ )
+				this -> peq[(unsigned char)name[i]] |= uint64_t(1) << i;
+			this -> last = uint64_t(1) << ( this -> m - 1 );
+		}
+
+		// distance to candidate, or bound + 1 when it exceeds the bound
+		size_t distance(const std::string& c) const {
+
+			size_t n = c.size();
+
+			if ( this -> bound == 0 || n == 0 || ( n > this -> m ? n - this -> m : this -> m - n ) > this -> bound )
+				return this -> bound + 1;
+
+			uint64_t pv = ~uint64_t(0), mv = 0;
+			size_t score = this -> m;
+
+			for ( size_t j = 0; j < n; j++ ) {
+
+				uint64_t eq = this -> peq[(unsigned char)c[j]];
+				uint64_t xv = eq | mv;
+				uint64_t xh = ((( eq & pv ) + pv ) ^ pv ) | eq;
+				uint64_t ph = mv | ~( xh | pv );
+				uint64_t mh = pv & xh;
+
+				if ( ph & this -> last ) score++;
+				else if ( mh & this -> last ) score--;
+
+				// every remaining character can lower the score by one at most
+				if ( score > this -> bound + ( n - j - 1 ))
+					return this -> bound + 1;
+
+				ph = ( ph << 1 ) | 1;
+				mh <<= 1;
+				pv = mh | ~( xv | ph );
+				mv = ph & xv;
+			}
+
+			return score;
+		}
+};
+
+// "did you mean": the option keys/words and command names of a schema view
+// closest to name, best first - at most three, ties only
+template <typename V>
+static std::vector<std::string> suggest_names(const V& u, const std::string& name) {
+
+	suggester_t s(name);
+	std::vector<std::string> best;
+	size_t best_d = s.bound + 1;
+
+	auto consider = [&s, &best, &best_d](const std::string& candidate, const std::string& display) {
+
+		// a candidate no longer than the edit distance shares nothing with the name
+		size_t d = s.distance(candidate);
+		if ( d > s.bound || d >= candidate.size())
+			return;
+
+		if ( d < best_d ) { // strictly closer: drop the rest, only ties may follow
+			best_d = d;
+			s.bound = d;
+			best.clear();
+		}
+
+		if ( best.size() < 3 && std::find(best.begin(), best.end(), display) == best.end())
+			best.push_back(display);
+	};
+
+	for ( size_t i = 0; i < u.size(); i++ ) {
+
+		std::string key(u.key(i)), word(u.word(i));
+
+		if ( !key.empty()) consider(key, "-" + key);
+		if ( !word.empty()) consider(word, "--" + word);
+	}
+
+	for ( size_t c = 0; c < u.commands(); c++ ) {
+
+		std::string command(u.command_name(c));
+		consider(command, command);
+	}
+
+	return best;
+}
+
+// an error record (see parse_args) back to an error_t, its name and value read
+// from the argument it refers to
+template <typename V>
+static usage_t::error_t make_error(const V& u, const std::vector<std::string>& args, const usage_t::error_ref_t& r) {
+
+	usage_t::error_t e = { .error = r.error, .type = r.type };
+
+	if ( r.positional ) // args is remainder() then
+		e.name = std::string(u.positional_name(r.option));
+	else if ( r.option >= 0 )
+		e.name = std::string(u.name(r.option));
+	else {
+		// as met: --name or --name=value, its dashes skipped
+		e.name = l_trim(args[r.arg].substr(r.offset));
+		if ( auto pos = e.name.find('='); pos != std::string::npos && e.name.at(0) != '0' )
+			e.name.erase(pos);
+	}
+
+	if ( r.error == usage_t::error_type::ARG_VALIDATION && r.offset != UINT32_MAX ) {
+
+		// a value of its own is taken whole, an attached one up to the end
+		e.value = r.offset == 0 ? args[r.arg] : l_trim(args[r.arg].substr(r.offset));
+
+		if ( r.type != usage_t::arg_type::STRING )
+			e.value = trim(e.value);
+	}
+
+	return e;
+}
+
+// what the parser carries from one argument to the next: resuming with a copy
+// taken before an argument parses the rest exactly as before (incremental.cpp)
+struct parse_state_t {
+	bool parsing = true;
+	int pending = -1;         // option waiting for its (required or optional) argument
+
+	// options met, for duplicate detection - cleared again when an option's
+	// argument fails, as the option is then dropped
+	std::vector<bool> seen;
+};
+
+// The parser proper. It walks the arguments once, from first, against the
+// options and commands of a schema view (usage_view_t above, or a compiled
+// schema - see schema.cpp) and reports what it meets to a sink instead of
+// storing anything itself:
+//
+//   option(index, value)              a recognised option, value checked
+//   positional(arg)
+//   command(position, name, index)    a subcommand - parsing stops there
+//   error(error_ref)                  refers to the argument, see make_error()
+//
+// validator_t's sink stores them (values, remainder, ..), parse() hands them
+// to user callbacks as they come. Sinks with binds set have bound variables
+// written as well - when parsing ends (or stops at a command), for the options
+// accepted by then. Sinks with checkpoints set are handed the state before
+// each argument (and before the end of arguments):
+//
+//   checkpoint(position, state)
+template <typename V, typename S>
+static void parse_args(const V& u, const std::vector<std::string>& args, size_t first, S& sink, parse_state_t& state) {
+
+	bool& parsing = state.parsing;
+	int& pending = state.pending;
+	std::vector<bool>& seen = state.seen;
+	size_t at = first; // argument being parsed, for error records
+
+	// single character keys -> option index, for bundled short options;
+	// only built when a bundle is met
+	std::array<int, 256> shorts;
+	bool shorts_built = false;
+
+	auto lookup = [&u](const std::string& name) {
+
+		USAGE_STAT(usage_t::stats().lookups++);
+		return u.find(name);
+	};
+
+	auto error = [&sink, &at](usage_t::error_ref_t&& e) {
+
+		e.arg = (uint32_t)at;
+		USAGE_STAT(usage_t::stats().errors[e.error]++);
+		sink.error(e);
+	};
+
+	// offset: where the failed value starts in the argument
+	auto fail = [&u, &seen, &error](int idx, usage_t::error_type t, size_t offset) {
+
+		seen[idx] = false;
+		error({ .error = t, .type = u.type(idx), .option = idx, .offset = (uint32_t)offset });
+	};
+
+	// values of bound options, as met: written to their variables once the
+	// options are final (see bind_all)
+	struct bound_t {
+		int idx;
+		std::string value;
+		size_t arg;
+		size_t offset;
+	};
+
+	std::vector<bound_t> bound;
+
+	auto store = [&u, &seen, &sink, &bound, &at](int idx, std::string&& value, size_t offset = UINT32_MAX) {
+
+		if constexpr ( S::binds )
+			if ( const usage_t::bind_t* bind = u.bind(idx); bind != nullptr && *bind )
+				bound.push_back({ .idx = idx, .value = value, .arg = at, .offset = offset });
+
+		seen[idx] = true;
+		sink.option(idx, std::move(value));
+	};
+
+	// writes the bound options still accepted - the last value of each, a
+	// value failing later drops its option - to their variables; a value that
+	// does not fit its variable fails like any invalid argument
+	auto bind_all = [&u, &seen, &bound, &at, &fail]() {
+
+		if ( bound.empty())
+			return;
+
+		std::vector<size_t> last(u.size(), SIZE_MAX);
+
+		for ( size_t i = 0; i < bound.size(); i++ )
+			last[bound[i].idx] = i;
+
+		for ( size_t i = 0; i < bound.size(); i++ ) {
+
+			const bound_t& b = bound[i];
+
+			if ( last[b.idx] != i || !seen[b.idx] || u.bind(b.idx) -> assign(b.value, u.type(b.idx)))
+				continue;
+
+			at = b.arg;
+			fail(b.idx, usage_t::error_type::ARG_VALIDATION, b.offset);
+		}
+
+		bound.clear();
+	};
+
+	// an option's argument: checked against its type before it is stored
+	auto take = [&u, &fail, &store](int idx, std::string&& value, size_t offset = 0) {
+
+		USAGE_STAT(usage_stat_timer_t _validation_timer(usage_t::stats().validation));
+
+		if ( !check_value(u.type(idx), value))
+			fail(idx, usage_t::error_type::ARG_VALIDATION, offset);
+		else store(idx, std::move(value), offset);
+	};
+
+	// an option met on its own: flags are stored now, the rest wait for
+	// their argument
+	auto start = [&u, &seen, &pending, &error, &store](int idx) {
+
+		if ( seen[idx] )
+			error({ .error = usage_t::error_type::DUPLICATE, .type = u.type(idx), .option = idx });
+
+		if ( u.flag(idx) == usage_t::arg_flag::NO )
+			store(idx, "");
+		else {
+			seen[idx] = true;
+			pending = idx;
+		}
+	};
+
+	for ( size_t _i = first; _i < args.size(); _i++ ) {
+
+		if constexpr ( S::checkpoints )
+			sink.checkpoint(_i, std::as_const(state));
+
+		const std::string& s = args[_i];
+		USAGE_STAT(usage_t::stats().tokens++);
+		at = _i;
+
+		if ( !parsing ) {
+			sink.positional(std::string(s));
+			continue;
+		}
+
+		if ( pending >= 0 && u.flag(pending) == usage_t::arg_flag::REQUIRED ) {
+
+			// whatever follows is the argument, even if it looks like an option
+			int idx = pending;
+			pending = -1;
+			take(idx, std::string(s));
+			continue;
+		}
+
+		if ( pending >= 0 ) { // optional argument: unless another option follows
+
+			int idx = pending;
+			pending = -1;
+
+			std::string v(trim(s));
+
+			while ( has_prefix(v, "--") && v != "--" )
+				v.erase(0, 1);
+
+			if ( !v.empty() && has_prefix(v, "-")) {
+
+				v.erase(0,1);
+				v = l_trim(v);
+
+				if ( int next = v.empty() ? -1 : lookup(v); next >= 0 && next != idx ) {
+
+					store(idx, "");
+					start(next);
+					continue;
+				}
+			}
+
+			take(idx, std::string(s));
+			continue;
+		}
+
+		std::string a(trim(s));
+		bool bundled = has_prefix(a, "-") && !has_prefix(a, "--");
+
+		while ( has_prefix(a, "--") && a != "--" )
+			a.erase(0, 1);
+
+		if ( a.empty())
+			continue;
+
+		if ( a == "--" ) {
+			// explicit end-of-options marker: everything after is positional
+			parsing = false;
+			continue;
+		}
+
+		if ( !has_prefix(a, "-")) {
+
+			// subcommand dispatch: if this positional names a declared
+			// command, the rest of the argument vector belongs to it and
+			// parsing stops here
+			if ( int c = u.command(a); c >= 0 ) {
+
+				if constexpr ( S::binds )
+					bind_all();
+
+				sink.command(_i, a, c);
+				return;
+			}
+
+			// a positional argument; collect it but keep parsing options that
+			// follow, so `cmd <positional> --option` works (e.g. subcommands)
+			sink.positional(std::move(a));
+			continue;
+		}
+
+		a.erase(0,1);
+		a = l_trim(a);
+
+		if ( a.empty())
+			continue;
+
+		if ( int idx = lookup(a); idx >= 0 ) {
+			start(idx);
+			continue;
+		}
+
+		// a is what is left of s once trimmed and its dashes stripped
+		size_t base = s.find_last_not_of(whitespace) + 1 - a.size();
+
+		// --option=value (or -k=value): when what comes before = is an option
+		// taking an argument - else a short bundle's attached value may hold
+		// the =, as in -ofoo=bar or -Dkey=val
+		if ( auto pos = a.find('='); pos != std::string::npos && a.at(0) != '0' ) {
+
+			if ( int idx = lookup(a.substr(0, pos)); idx >= 0 && u.flag(idx) != usage_t::arg_flag::NO ) {
+
+				if ( seen[idx] )
+					error({ .error = usage_t::error_type::DUPLICATE, .type = u.type(idx), .option = idx });
+
+				take(idx, a.substr(pos + 1), base + pos + 1);
+				continue;
+			}
+		}
+
+		if ( bundled && a.size() > 1 ) {
+
+			// POSIX-style bundle of single character keys: `-abc` is -a -b -c;
+			// the first one taking an argument ends it, the rest of the bundle
+			// (if any) being its value: `-xvf file`, `-n5`
+			if ( !shorts_built ) {
+
+				shorts.fill(-1);
+				for ( size_t i = u.size(); i-- > 0; )
+					if ( u.key(i).size() == 1 )
+						shorts[(unsigned char)u.key(i).front()] = (int)i;
+				shorts_built = true;
+			}
+
+			size_t end = 0;
+			bool known = true;
+
+			for ( ; end < a.size(); end++ ) {
+
+				USAGE_STAT(usage_t::stats().lookups++);
+				int idx = shorts[(unsigned char)a[end]];
+
+				if ( idx < 0 ) {
+					known = false;
+					break;
+				}
+
+				if ( u.flag(idx) != usage_t::arg_flag::NO ) {
+					end++;
+					break;
+				}
+			}
+
+			if ( known ) {
+
+				for ( size_t i = 0; i < end; i++ )
+					start(shorts[(unsigned char)a[i]]);
+
+				if ( pending >= 0 && end < a.size()) { // value attached: -n5
+					int idx = pending;
+					pending = -1;
+					take(idx, a.substr(end), base + end);
+				}
+
+				continue;
+			}
+		}
+
+		error({ .error = usage_t::error_type::UNKNOWN_OPTION, .offset = (uint32_t)base });
+	}
+
+	if constexpr ( S::checkpoints )
+		sink.checkpoint(args.size(), std::as_const(state));
+
+	if ( pending >= 0 ) {
+
+		if ( u.flag(pending) == usage_t::arg_flag::REQUIRED )
+			fail(pending, usage_t::error_type::MISSING_ARG, 0);
+		else store(pending, "");
+	}
+
+	if constexpr ( S::binds )
+		bind_all();
+}
+
+
+template <typename V, typename S>
+static void parse_args(const V& u, const std::vector<std::string>& args, size_t first, S& sink) {
+
+	parse_state_t state = { .seen = std::vector<bool>(u.size()) };
+	parse_args(u, args, first, sink, state);
+}
+
+// the variadic slot's values: args from first on, converted to type - in
+// parallel when there are many (positional.cpp). Indexes in args of those that
+// do not fit are added to failed, in order.
+std::shared_ptr<usage_t::variadic_t> convert_variadic(usage_t::arg_type type, const std::vector<std::string>& args,
+	size_t first, std::vector<size_t>& failed);
+
+// throws std::invalid_argument for slots no parse can fill as declared: a
+// variadic slot that is not the last, or a slot named as an option - the two
+// would share one entry of values (positional.cpp)
+void check_slots(const usage_t& u);
+
+// The positional slots of a schema view checked against the positionals its
+// parse collected (remainder), once its arguments are parsed - every entry
+// point runs this after parse_args, unless a command was dispatched: the
+// positionals after it are the command's. Reported to the sink as:
+//
+//   slot(index, value)                a single slot's value, checked
+//   variadic(values)                  the variadic slot's values, converted
+//   error(error_ref)                  positional set: option is the slot, arg
+//                                     the index in remainder
+template <typename V, typename S>
+static void parse_positionals(const V& u, const std::vector<std::string>& remainder, S& sink) {
+
+	size_t n = 0;
+
+	auto error = [&sink](usage_t::error_type t, usage_t::arg_type type, size_t slot, size_t arg) {
+
+		USAGE_STAT(usage_t::stats().errors[t]++);
+		sink.error({ .error = t, .type = type, .positional = true, .option = (int32_t)slot, .arg = (uint32_t)arg });
+	};
+
+	for ( size_t slot = 0; slot < u.positionals(); slot++ ) {
+
+		usage_t::arg_type type = u.positional_type(slot);
+
+		if ( u.positional_variadic(slot)) {
+
+			USAGE_STAT(usage_stat_timer_t _validation_timer(usage_t::stats().validation));
+
+			std::vector<size_t> failed;
+			std::shared_ptr<usage_t::variadic_t> values = convert_variadic(type, remainder, n, failed);
+
+			for ( size_t arg : failed )
+				error(usage_t::error_type::ARG_VALIDATION, type, slot, arg);
+
+			sink.variadic(std::move(values));
+			break;
+		}
+
+		if ( n >= remainder.size()) {
+			error(usage_t::error_type::MISSING_ARG, type, slot, n);
+			continue;
+		}
+
+		std::string v(remainder[n]);
+
+		if ( check_value(type, v))
+			sink.slot(slot, std::move(v));
+		else error(usage_t::error_type::ARG_VALIDATION, type, slot, n);
+
+		n++;
+	}
+}
+
+// builds a parsed_t, recursing into subcommands for results of their own;
+// the schema is only read
+template <typename V>
+struct parsed_sink_t {
+
+	static constexpr bool binds = false;
+	static constexpr bool checkpoints = false;
+
+	V u;
+	usage_t::parsed_t* p;
+	const std::vector<std::string>& args;
+
+	void option(int idx, std::string&& value) {
+		this -> p -> values[std::string(this -> u.name(idx))] = std::move(value);
+	}
+
+	void positional(std::string&& arg) {
+		this -> p -> remainder.push_back(std::move(arg));
+	}
+
+	void slot(size_t i, std::string&& value) {
+		this -> p -> values[std::string(this -> u.positional_name(i))] = std::move(value);
+	}
+
+	void variadic(std::shared_ptr<usage_t::variadic_t>&& values) {
+		this -> p -> variadic = std::move(values);
+	}
+
+	void error(const usage_t::error_ref_t& e) {
+
+		if ( !e.positional && ( e.error == usage_t::error_type::ARG_VALIDATION || e.error == usage_t::error_type::MISSING_ARG ))
+			this -> p -> values.erase(std::string(this -> u.name(e.option)));
+
+		// a result outlives the arguments it was parsed from: text is taken now
+		this -> p -> errors.push_back(make_error(this -> u, e.positional ? this -> p -> remainder : this -> args, e));
+	}
+
+	// the schema's fallbacks, for options not in values - shared, not copied
+	static void fallbacks(V u, usage_t::parsed_t* p) {
+		p -> fallbacks = u.fallbacks();
+	}
+
+	// parses args from first on into p, positional slots and fallbacks included
+	static void parse(V u, const std::vector<std::string>& args, size_t first, usage_t::parsed_t* p) {
+
+		parsed_sink_t sink = { .u = u, .p = p, .args = args };
+		parse_args(u, args, first, sink);
+
+		if ( p -> command.empty())
+			parse_positionals(u, p -> remainder, sink);
+
+		fallbacks(u, p);
+	}
+
+	void command(size_t pos, const std::string& name, int c) {
+
+		this -> p -> command = name;
+		this -> p -> tail.assign(this -> args.begin() + pos + 1, this -> args.end());
+
+		if ( V target = this -> u.child(c); target ) {
+
+			USAGE_STAT(usage_stat_timer_t _dispatch_timer(usage_t::stats().dispatch[name]));
+
+			auto sub = std::make_shared<usage_t::parsed_t>();
+			parse(target, this -> args, pos + 1, sub.get());
+			this -> p -> sub = std::move(sub);
+		}
+	}
+};
@@ -0,0 +1,131 @@
+#include <string>
+#include <vector>
+#include <thread>
+#include <system_error>
+#include <stdexcept>
+#include <cerrno>
+#include <cstdlib>
+
+#include "usage.hpp"
+#include "parser.hpp"
+
+// variadic slots with at least this many values are converted in parallel
+static constexpr size_t parallel_min = 65536;
+
+size_t usage_t::variadic_t::size() const {
+	return this -> ints.size() + this -> hex.size() + this -> floats.size() + this -> strings.size();
+}
+
+const usage_t::variadic_t& usage_t::variadic() const {
+
+	static const usage_t::variadic_t none;
+	return this -> validated.variadic ? *this -> validated.variadic : none;
+}
+
+void check_slots(const usage_t& u) {
+
+	for ( size_t i = 0; i < u.positionals.size(); i++ ) {
+
+		const usage_t::positional_t& slot = u.positionals[i];
+
+		if ( slot.variadic && i + 1 != u.positionals.size())
+			throw std::invalid_argument("positional slot '" + slot.name + "' is variadic but not the last");
+
+		for ( const auto& opt : u.options )
+			if ( opt.first == slot.name )
+				throw std::invalid_argument("positional slot '" + slot.name + "' has the name of an option");
+	}
+}
+
+// checks arg against the slot's type and writes it, converted, to slot i of
+// out; left as is (zero, empty) if it does not fit
+static bool convert(usage_t::variadic_t& out, size_t i, const std::string& arg) {
+
+	std::string v(arg);
+
+	if ( !check_value(out.type, v))
+		return false;
+
+	if ( out.type == usage_t::arg_type::STRING ) {
+		out.strings[i] = std::move(v);
+		return true;
+	} else if ( out.type == usage_t::arg_type::BOOL ) {
+		out.ints[i] = v == "true" ? 1 : 0;
+		return true;
+	}
+
+	const char* str = v.c_str();
+	char* end = nullptr;
+	errno = 0;
+
+	if ( out.type == usage_t::arg_type::INT ) {
+		long long l = std::strtoll(str, &end, 10);
+		if ( end == str || *end != 0 || errno != 0 )
+			return false;
+		out.ints[i] = l;
+	} else if ( out.type == usage_t::arg_type::HEX ) {
+		unsigned long long l = std::strtoull(str, &end, 16);
+		if ( end == str || *end != 0 || errno != 0 )
+			return false;
+		out.hex[i] = l;
+	} else if ( out.type == usage_t::arg_type::FLOAT ) {
+		double d = std::strtod(str, &end);
+		if ( end == str || *end != 0 || errno != 0 )
+			return false;
+		out.floats[i] = d;
+	}
+
+	return true;
+}
+
+// converts args[first + begin, first + end) into out, adding the index in
+// args of what does not fit to failed
+static void convert_range(usage_t::variadic_t& out, const std::vector<std::string>& args,
+		size_t first, size_t begin, size_t end, std::vector<size_t>& failed) {
+
+	for ( size_t i = begin; i < end; i++ )
+		if ( !convert(out, i, args[first + i]))
+			failed.push_back(first + i);
+}
+
+std::shared_ptr<usage_t::variadic_t> convert_variadic(usage_t::arg_type type, const std::vector<std::string>& args,
+		size_t first, std::vector<size_t>& failed) {
+
+	auto out = std::make_shared<usage_t::variadic_t>();
+	size_t count = args.size() > first ? args.size() - first : 0;
+
+	out -> type = type;
+
+	if ( type == usage_t::arg_type::STRING ) out -> strings.resize(count);
+	else if ( type == usage_t::arg_type::HEX ) out -> hex.resize(count);
+	else if ( type == usage_t::arg_type::FLOAT ) out -> floats.resize(count);
+	else out -> ints.resize(count);
+
+	// one chunk per core, each writing its own part of the arrays; a chunk
+	// whose thread cannot be started is converted here instead
+	size_t workers = count < parallel_min ? 1 : std::max(1u, std::thread::hardware_concurrency());
+	size_t chunk = workers == 1 ? count : ( count + workers - 1 ) / workers;
+	std::vector<std::vector<size_t>> failures(workers);
+	std::vector<std::thread> threads;
+
+	for ( size_t w = 1; w < workers; w++ ) {
+
+		size_t begin = std::min(count, w * chunk), end = std::min(count, begin + chunk);
+
+		try {
+			threads.emplace_back(convert_range, std::ref(*out), std::cref(args), first, begin, end, std::ref(failures[w]));
+		} catch ( const std::system_error& ) {
+			convert_range(*out, args, first, begin, end, failures[w]);
+		}
+	}
+
+	convert_range(*out, args, first, 0, std::min(count, chunk), failures[0]);
+
+	for ( auto& t : threads )
+		t.join();
+
+	for ( const auto& f : failures )
+		failed.insert(failed.end(), f.begin(), f.end());
+
+	return out;
+}
@@ -0,0 +1,744 @@
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
+#include <ostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "usage.hpp"
+#include "parser.hpp"
+#include "util.hpp"
+
+// Compiled schema image. Everything is fixed size and refers to other parts
+// by index or offset, so that a mapped file is used as it is:
+//
+//   header | nodes | keys | words | flags | types | option texts | commands |
+//   slots | positionals | string pool
+//
+// A node is one usage_t of the commands tree (the root first); its options,
+// commands and positional slots are contiguous ranges, and options and
+// commands each have an open addressing hash table (a range of slots) over
+// option keys/words and command names. Options are
+// stored as parallel arrays: what lookups and the parser touch (keys, words,
+// flags, types) packed apart from what only results and help need (names,
+// descriptions, fallbacks). Strings are interned - each distinct one is in the pool once.
+
+static const char image_magic[8] = { 'u', 's', 'a', 'g', 'e', 'c', 'p', 'p' };
+static const uint32_t image_version = 4;
+static const uint32_t raw_node = UINT32_MAX;
+
+// an option's fallback: a callable one is only in the process that compiled
+// the image (schema_t::_fallbacks) - a loaded image has none for it
+static const uint32_t no_fallback = 0;
+static const uint32_t constant_fallback = 1;
+static const uint32_t callable_fallback = 2;
+
+struct image_str_t {
+	uint32_t off;
+	uint32_t len;
+};
+
+struct image_header_t {
+	char magic[8];
+	uint32_t version;
+	uint32_t nodes;
+	uint64_t size;               // whole image
+	uint64_t hash;               // FNV-1a of everything after the header
+	uint64_t source;
+	uint32_t options;
+	uint32_t commands;
+	uint32_t slots;
+	uint32_t pool;
+	uint32_t positionals;
+	uint32_t reserved;
+	uint64_t node_off;
+	uint64_t key_off;            // image_str_t per option
+	uint64_t word_off;           // image_str_t per option
+	uint64_t flag_off;           // uint8_t per option
+	uint64_t type_off;           // uint8_t per option
+	uint64_t text_off;           // image_text_t per option
+	uint64_t command_off;
+	uint64_t slot_off;
+	uint64_t positional_off;
+	uint64_t pool_off;
+};
+
+struct image_node_t {
+	uint32_t option, options;    // range of options
+	uint32_t command, commands;  // range of commands
+	uint32_t slot, slots;        // option index: key/word -> option + 1, 0 if free
+	uint32_t cslot, cslots;      // command index: name -> command + 1
+	uint32_t positional, positionals;   // range of positional slots
+	image_str_t help;
+};
+
+// the parts of an option lookups never touch
+struct image_text_t {
+	image_str_t name;
+	image_str_t desc;
+	image_str_t arg;
+	image_str_t fallback;        // a constant one's value
+	uint32_t fallback_kind;
+};
+
+struct image_command_t {
+	image_str_t name;
+	uint32_t node;               // raw_node for a raw passthrough
+};
+
+struct image_positional_t {
+	image_str_t name;
+	image_str_t desc;
+	uint16_t type;
+	uint16_t variadic;
+};
+
+static uint64_t fnv1a(const unsigned char* data, size_t size) {
+
+	fnv1a_t h;
+	h.add(data, size);
+	return h.hash;
+}
+
+static uint32_t slot_hash(std::string_view s) {
+
+	uint32_t h = 2166136261u;
+
+	for ( unsigned char ch : s ) {
+		h ^= ch;
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+// the schema view of a compiled image, see usage_view_t
+struct image_view_t {
+
+	const unsigned char* base;
+	const image_header_t* h;
+	const image_node_t* n;
+	const std::shared_ptr<const usage_t::fallbacks_t>* by_node;    // the schema's fallbacks, per node
+
+	explicit operator bool() const { return this -> n != nullptr; }
+
+	std::string_view str(const image_str_t& s) const {
+		return std::string_view((const char*)this -> base + this -> h -> pool_off + s.off, s.len);
+	}
+
+	template <typename T>
+	const T& at(uint64_t off, size_t i) const {
+		return ((const T*)( this -> base + off ))[this -> n -> option + i];
+	}
+
+	const image_command_t& cmd(size_t i) const {
+		return ((const image_command_t*)( this -> base + this -> h -> command_off ))[this -> n -> command + i];
+	}
+
+	const uint32_t* slots() const {
+		return (const uint32_t*)( this -> base + this -> h -> slot_off );
+	}
+
+	size_t size() const { return this -> n -> options; }
+
+	int find(const std::string& name) const {
+
+		if ( this -> n -> slots == 0 )
+			return -1;
+
+		const uint32_t* slot = this -> slots() + this -> n -> slot;
+		uint32_t mask = this -> n -> slots - 1;
+
+		for ( uint32_t i = slot_hash(name) & mask; slot[i] != 0; i = ( i + 1 ) & mask ) {
+
+			if ( this -> key(slot[i] - 1) == name || this -> word(slot[i] - 1) == name )
+				return (int)slot[i] - 1;
+		}
+
+		return -1;
+	}
+
+	std::string_view name(size_t i) const { return this -> str(this -> at<image_text_t>(this -> h -> text_off, i).name); }
+	std::string_view key(size_t i) const { return this -> str(this -> at<image_str_t>(this -> h -> key_off, i)); }
+	std::string_view word(size_t i) const { return this -> str(this -> at<image_str_t>(this -> h -> word_off, i)); }
+	usage_t::arg_flag flag(size_t i) const { return (usage_t::arg_flag)this -> at<uint8_t>(this -> h -> flag_off, i); }
+	usage_t::arg_type type(size_t i) const { return (usage_t::arg_type)this -> at<uint8_t>(this -> h -> type_off, i); }
+	const usage_t::bind_t* bind(size_t) const { return nullptr; }
+
+	std::shared_ptr<const usage_t::fallbacks_t> fallbacks() const {
+		return this -> by_node[this -> n - (const image_node_t*)( this -> base + this -> h -> node_off )];
+	}
+
+	int command(const std::string& name) const {
+
+		if ( this -> n -> cslots == 0 )
+			return -1;
+
+		const uint32_t* slot = this -> slots() + this -> n -> cslot;
+		uint32_t mask = this -> n -> cslots - 1;
+
+		for ( uint32_t i = slot_hash(name) & mask; slot[i] != 0; i = ( i + 1 ) & mask )
+			if ( this -> str(this -> cmd(slot[i] - 1).name) == name )
+				return (int)slot[i] - 1;
+
+		return -1;
+	}
+
+	image_view_t child(int c) const {
+
+		uint32_t node = this -> cmd(c).node;
+
+		if ( node == raw_node )
+			return { this -> base, this -> h, nullptr, this -> by_node };
+
+		return { this -> base, this -> h, (const image_node_t*)( this -> base + this -> h -> node_off ) + node, this -> by_node };
+	}
+
+	size_t commands() const { return this -> n -> commands; }
+	std::string_view command_name(size_t c) const { return this -> str(this -> cmd(c).name); }
+
+	const image_positional_t& positional(size_t i) const {
+		return ((const image_positional_t*)( this -> base + this -> h -> positional_off ))[this -> n -> positional + i];
+	}
+
+	size_t positionals() const { return this -> n -> positionals; }
+	std::string_view positional_name(size_t i) const { return this -> str(this -> positional(i).name); }
+	usage_t::arg_type positional_type(size_t i) const { return (usage_t::arg_type)this -> positional(i).type; }
+	bool positional_variadic(size_t i) const { return this -> positional(i).variadic != 0; }
+};
+
+// collects the image sections while walking the commands tree
+struct image_builder_t {
+
+	std::vector<image_node_t> nodes;
+	std::vector<image_str_t> keys, words;
+	std::vector<uint8_t> flags, types;
+	std::vector<image_text_t> texts;
+	std::vector<image_command_t> commands;
+	std::vector<uint32_t> slots;
+	std::vector<image_positional_t> positionals;
+	std::vector<std::shared_ptr<const usage_t::fallbacks_t>> fallbacks;   // per node
+	std::string pool;
+	std::unordered_map<std::string, image_str_t> interned;
+
+	image_str_t str(const std::string& s) {
+
+		if ( s.empty())
+			return { 0, 0 };
+
+		auto [it, added] = this -> interned.emplace(s, image_str_t{ (uint32_t)this -> pool.size(), (uint32_t)s.size() });
+
+		if ( added )
+			this -> pool += s;
+
+		return it -> second;
+	}
+
+	std::string_view view(const image_str_t& s) const {
+		return std::string_view(this -> pool.data() + s.off, s.len);
+	}
+
+	// open addressing table of entries + 1, at least twice the entries in
+	// size; names already present keep their first entry, as a linear scan would
+	template <typename F>
+	void index(uint32_t& first, uint32_t& count, const std::vector<std::pair<std::string_view, uint32_t>>& entries, F names_of) {
+
+		first = (uint32_t)this -> slots.size();
+		count = 0;
+
+		if ( entries.empty())
+			return;
+
+		count = 1;
+		while ( count < entries.size() * 2 )
+			count <<= 1;
+
+		this -> slots.resize(this -> slots.size() + count, 0);
+		uint32_t* slot = this -> slots.data() + first;
+
+		for ( const auto& e : entries ) {
+
+			uint32_t i = slot_hash(e.first) & ( count - 1 );
+			bool present = false;
+
+			for ( ; slot[i] != 0; i = ( i + 1 ) & ( count - 1 ))
+				if ( names_of(slot[i] - 1, e.first)) {
+					present = true;
+					break;
+				}
+
+			if ( !present )
+				slot[i] = e.second + 1;
+		}
+	}
+};
+
+std::shared_ptr<const usage_t::schema_t> usage_t::schema_t::compile(const usage_t& usage, uint64_t source) {
+
+	image_builder_t b;
+
+	// breadth first, so a node's index is known when its parent lists it
+	struct pending_t {
+		const usage_t* u;
+		std::string cmd;
+	};
+
+	std::deque<pending_t> queue = {{ &usage, usage.args.cmd() }};
+	b.nodes.push_back({});
+
+	for ( size_t n = 0; !queue.empty(); n++ ) {
+
+		pending_t p = queue.front();
+		queue.pop_front();
+		check_slots(*p.u);
+
+		image_node_t node = {};
+		node.option = (uint32_t)b.keys.size();
+		node.options = (uint32_t)p.u -> options.size();
+		node.command = (uint32_t)b.commands.size();
+		node.commands = (uint32_t)p.u -> commands.size();
+		node.positional = (uint32_t)b.positionals.size();
+		node.positionals = (uint32_t)p.u -> positionals.size();
+
+		for ( const auto& slot : p.u -> positionals )
+			b.positionals.push_back({ b.str(slot.name), b.str(slot.desc), (uint16_t)slot.type, (uint16_t)slot.variadic });
+
+		std::vector<std::pair<std::string_view, uint32_t>> entries;
+
+		for ( const auto& opt : p.u -> options ) {
+
+			const usage_t::default_t& f = opt.second.fallback;
+			image_text_t text = { b.str(opt.first), b.str(opt.second.desc), b.str(opt.second.name), {}, no_fallback };
+
+			// a constant is checked now, a callback is left to first use
+			if ( f && f.callable())
+				text.fallback_kind = callable_fallback;
+			else if ( f ) {
+				text.fallback = b.str(f.value(opt.second.type));
+				text.fallback_kind = constant_fallback;
+			}
+
+			b.keys.push_back(b.str(opt.second.key));
+			b.words.push_back(b.str(opt.second.word));
+			b.flags.push_back((uint8_t)opt.second.flag);
+			b.types.push_back((uint8_t)opt.second.type);
+			b.texts.push_back(text);
+		}
+
+		b.fallbacks.push_back(p.u -> fallbacks());
+
+		for ( uint32_t i = 0; i < node.options; i++ ) {
+			if ( b.keys[node.option + i].len != 0 ) entries.push_back({ b.view(b.keys[node.option + i]), i });
+			if ( b.words[node.option + i].len != 0 ) entries.push_back({ b.view(b.words[node.option + i]), i });
+		}
+
+		b.index(node.slot, node.slots, entries, [&b, &node](uint32_t i, std::string_view name) {
+			return b.view(b.keys[node.option + i]) == name || b.view(b.words[node.option + i]) == name;
+		});
+
+		entries.clear();
+
+		for ( const auto& c : p.u -> commands ) {
+
+			image_command_t cmd = { b.str(c.first), raw_node };
+
+			if ( c.second ) {
+				cmd.node = (uint32_t)b.nodes.size();
+				b.nodes.push_back({});
+				queue.push_back({ c.second.get(), p.cmd + " " + c.first });
+			}
+
+			b.commands.push_back(cmd);
+		}
+
+		for ( uint32_t i = 0; i < node.commands; i++ )
+			entries.push_back({ b.view(b.commands[node.command + i].name), i });
+
+		b.index(node.cslot, node.cslots, entries, [&b, &node](uint32_t i, std::string_view name) {
+			return b.view(b.commands[node.command + i].name) == name;
+		});
+
+		// help as the command would print it: with its own command line
+		usage_t u(*p.u);
+		u.args._cmd = p.cmd;
+		node.help = b.str(u.help());
+
+		b.nodes[n] = node;
+	}
+
+	auto align = [](uint64_t off) { return ( off + 7 ) & ~uint64_t(7); };
+
+	image_header_t h = {};
+	std::memcpy(h.magic, image_magic, sizeof(h.magic));
+	h.version = image_version;
+	h.source = source;
+	h.nodes = (uint32_t)b.nodes.size();
+	h.options = (uint32_t)b.keys.size();
+	h.commands = (uint32_t)b.commands.size();
+	h.slots = (uint32_t)b.slots.size();
+	h.positionals = (uint32_t)b.positionals.size();
+	h.pool = (uint32_t)b.pool.size();
+	h.node_off = align(sizeof(h));
+	h.key_off = align(h.node_off + b.nodes.size() * sizeof(image_node_t));
+	h.word_off = align(h.key_off + b.keys.size() * sizeof(image_str_t));
+	h.flag_off = align(h.word_off + b.words.size() * sizeof(image_str_t));
+	h.type_off = align(h.flag_off + b.flags.size());
+	h.text_off = align(h.type_off + b.types.size());
+	h.command_off = align(h.text_off + b.texts.size() * sizeof(image_text_t));
+	h.slot_off = align(h.command_off + b.commands.size() * sizeof(image_command_t));
+	h.positional_off = align(h.slot_off + b.slots.size() * sizeof(uint32_t));
+	h.pool_off = align(h.positional_off + b.positionals.size() * sizeof(image_positional_t));
+	h.size = h.pool_off + b.pool.size();
+
+	std::shared_ptr<usage_t::schema_t> s(new usage_t::schema_t());
+	s -> _image.resize(h.size, 0);
+
+	unsigned char* data = s -> _image.data();
+	// an empty section has no data() to copy from
+	auto copy = [data](uint64_t off, const void* from, size_t size) {
+		if ( size )
+			std::memcpy(data + off, from, size);
+	};
+
+	copy(h.node_off, b.nodes.data(), b.nodes.size() * sizeof(image_node_t));
+	copy(h.key_off, b.keys.data(), b.keys.size() * sizeof(image_str_t));
+	copy(h.word_off, b.words.data(), b.words.size() * sizeof(image_str_t));
+	copy(h.flag_off, b.flags.data(), b.flags.size());
+	copy(h.type_off, b.types.data(), b.types.size());
+	copy(h.text_off, b.texts.data(), b.texts.size() * sizeof(image_text_t));
+	copy(h.command_off, b.commands.data(), b.commands.size() * sizeof(image_command_t));
+	copy(h.slot_off, b.slots.data(), b.slots.size() * sizeof(uint32_t));
+	copy(h.positional_off, b.positionals.data(), b.positionals.size() * sizeof(image_positional_t));
+	copy(h.pool_off, b.pool.data(), b.pool.size());
+
+	h.hash = fnv1a(data + sizeof(h), h.size - sizeof(h));
+	std::memcpy(data, &h, sizeof(h));
+
+	s -> _data = data;
+	s -> _size = h.size;
+	s -> _fallbacks = std::move(b.fallbacks);
+	return s;
+}
+
+// every index and offset within its section, every hash table a power of two
+// in size with a free slot - a probe ends at one: the content hash is no
+// guard against a crafted file, anyone can compute it
+static bool valid(const unsigned char* data) {
+
+	const image_header_t* h = (const image_header_t*)data;
+	const image_node_t* nodes = (const image_node_t*)( data + h -> node_off );
+	const image_str_t* keys = (const image_str_t*)( data + h -> key_off );
+	const image_str_t* words = (const image_str_t*)( data + h -> word_off );
+	const uint8_t* flags = data + h -> flag_off;
+	const uint8_t* types = data + h -> type_off;
+	const image_text_t* texts = (const image_text_t*)( data + h -> text_off );
+	const image_command_t* commands = (const image_command_t*)( data + h -> command_off );
+	const uint32_t* slots = (const uint32_t*)( data + h -> slot_off );
+	const image_positional_t* positionals = (const image_positional_t*)( data + h -> positional_off );
+
+	auto range = [](uint32_t first, uint32_t count, uint32_t size) {
+		return first <= size && count <= size - first;
+	};
+
+	auto str = [h, &range](const image_str_t& s) {
+		return range(s.off, s.len, h -> pool);
+	};
+
+	// entries: slots hold an entry + 1, or 0 if free
+	auto table = [h, slots, &range](uint32_t first, uint32_t count, uint32_t entries) {
+
+		if ( count == 0 )
+			return true;
+
+		if ( !range(first, count, h -> slots) || ( count & ( count - 1 )) != 0 )
+			return false;
+
+		bool free = false;
+
+		for ( uint32_t i = first; i < first + count; i++ ) {
+			if ( slots[i] > entries ) return false;
+			if ( slots[i] == 0 ) free = true;
+		}
+
+		return free;
+	};
+
+	for ( uint32_t n = 0; n < h -> nodes; n++ ) {
+
+		const image_node_t& node = nodes[n];
+
+		if ( !range(node.option, node.options, h -> options) || !range(node.command, node.commands, h -> commands) ||
+			!table(node.slot, node.slots, node.options) || !table(node.cslot, node.cslots, node.commands) ||
+			!range(node.positional, node.positionals, h -> positionals) || !str(node.help))
+			return false;
+
+		// a variadic slot is the last of its node
+		for ( uint32_t i = 0; i + 1 < node.positionals; i++ )
+			if ( positionals[node.positional + i].variadic )
+				return false;
+	}
+
+	for ( uint32_t i = 0; i < h -> options; i++ )
+		if ( !str(keys[i]) || !str(words[i]) || !str(texts[i].name) || !str(texts[i].desc) || !str(texts[i].arg) ||
+			!str(texts[i].fallback) || texts[i].fallback_kind > callable_fallback ||
+			flags[i] > usage_t::arg_flag::OPTIONAL || types[i] > usage_t::arg_type::HEX )
+			return false;
+
+	for ( uint32_t i = 0; i < h -> commands; i++ )
+		if ( !str(commands[i].name) || ( commands[i].node != raw_node && commands[i].node >= h -> nodes ))
+			return false;
+
+	for ( uint32_t i = 0; i < h -> positionals; i++ )
+		if ( !str(positionals[i].name) || !str(positionals[i].desc) || positionals[i].type > usage_t::arg_type::HEX ||
+			positionals[i].variadic > 1 )
+			return false;
+
+	return true;
+}
+
+std::shared_ptr<const usage_t::schema_t> usage_t::schema_t::load(const std::string& path, uint64_t source) {
+
+	int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+	if ( fd < 0 )
+		return nullptr;
+
+	struct stat st;
+	void* map = MAP_FAILED;
+
+	if ( fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(image_header_t))
+		map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	::close(fd);
+
+	if ( map == MAP_FAILED )
+		return nullptr;
+
+	std::shared_ptr<usage_t::schema_t> s(new usage_t::schema_t());
+	s -> _data = (const unsigned char*)map;
+	s -> _size = st.st_size;
+	s -> _mapped = true;
+
+	const image_header_t* h = (const image_header_t*)map;
+
+	// sections are 8 byte aligned, as compile() lays them out
+	auto fits = [h](uint64_t off, uint64_t count, uint64_t size) {
+		return off % 8 == 0 && off <= h -> size && count <= ( h -> size - off ) / size;
+	};
+
+	if ( std::memcmp(h -> magic, image_magic, sizeof(h -> magic)) != 0 || h -> version != image_version ||
+		h -> size != s -> _size || ( source != 0 && h -> source != source ) || h -> nodes == 0 ||
+		!fits(h -> node_off, h -> nodes, sizeof(image_node_t)) ||
+		!fits(h -> key_off, h -> options, sizeof(image_str_t)) ||
+		!fits(h -> word_off, h -> options, sizeof(image_str_t)) ||
+		!fits(h -> flag_off, h -> options, 1) ||
+		!fits(h -> type_off, h -> options, 1) ||
+		!fits(h -> text_off, h -> options, sizeof(image_text_t)) ||
+		!fits(h -> command_off, h -> commands, sizeof(image_command_t)) ||
+		!fits(h -> slot_off, h -> slots, sizeof(uint32_t)) ||
+		!fits(h -> positional_off, h -> positionals, sizeof(image_positional_t)) ||
+		!fits(h -> pool_off, h -> pool, 1) ||
+		fnv1a(s -> _data + sizeof(image_header_t), h -> size - sizeof(image_header_t)) != h -> hash ||
+		!valid(s -> _data))
+		return nullptr;
+
+	// constant fallbacks, from the pool, by name for each node
+	const image_node_t* nodes = (const image_node_t*)( s -> _data + h -> node_off );
+	const image_text_t* texts = (const image_text_t*)( s -> _data + h -> text_off );
+	const uint8_t* types = s -> _data + h -> type_off;
+	std::string_view pool((const char*)s -> _data + h -> pool_off, h -> pool);
+
+	s -> _fallbacks.resize(h -> nodes);
+
+	for ( uint32_t n = 0; n < h -> nodes; n++ ) {
+
+		std::shared_ptr<usage_t::fallbacks_t> index;
+
+		for ( uint32_t i = nodes[n].option; i < nodes[n].option + nodes[n].options; i++ ) {
+
+			if ( texts[i].fallback_kind != constant_fallback )
+				continue;
+
+			if ( !index )
+				index = std::make_shared<usage_t::fallbacks_t>();
+
+			index -> emplace(pool.substr(texts[i].name.off, texts[i].name.len), usage_t::fallback_t{
+				.fallback = std::string(pool.substr(texts[i].fallback.off, texts[i].fallback.len)), .type = (usage_t::arg_type)types[i] });
+		}
+
+		s -> _fallbacks[n] = std::move(index);
+	}
+
+	return s;
+}
+
+usage_t::schema_t::~schema_t() {
+
+	if ( this -> _mapped )
+		munmap((void*)this -> _data, this -> _size);
+}
+
+bool usage_t::schema_t::write(const std::string& path) const {
+
+	// written aside and renamed over, so that readers never map a partial file
+	std::string tmp = path + ".tmp." + std::to_string(getpid());
+	int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+	if ( fd < 0 )
+		return false;
+
+	size_t done = 0;
+
+	while ( done < this -> _size ) {
+
+		ssize_t n = ::write(fd, this -> _data + done, this -> _size - done);
+
+		if ( n <= 0 )
+			break;
+		done += n;
+	}
+
+	if ( ::close(fd) != 0 || done != this -> _size || ::rename(tmp.c_str(), path.c_str()) != 0 ) {
+		::unlink(tmp.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+uint64_t usage_t::schema_t::hash() const {
+	return ((const image_header_t*)this -> _data) -> hash;
+}
+
+uint64_t usage_t::schema_t::source() const {
+	return ((const image_header_t*)this -> _data) -> source;
+}
+
+static image_view_t root_view(const unsigned char* data, const std::vector<std::shared_ptr<const usage_t::fallbacks_t>>& fallbacks) {
+
+	const image_header_t* h = (const image_header_t*)data;
+	return { data, h, (const image_node_t*)( data + h -> node_off ), fallbacks.data() };
+}
+
+std::string_view usage_t::schema_t::help(const std::vector<std::string>& command) const {
+
+	image_view_t v = root_view(this -> _data, this -> _fallbacks);
+
+	for ( const auto& c : command ) {
+
+		int i = v.command(c);
+		if ( i < 0 || !( v = v.child(i)))
+			return "";
+	}
+
+	return v.str(v.n -> help);
+}
+
+std::shared_ptr<const usage_t::parsed_t> usage_t::schema_t::parse(const std::vector<std::string>& args) const {
+
+	USAGE_STAT(usage_stat_timer_t _parse_timer(usage_t::stats().parse));
+
+	auto p = std::make_shared<usage_t::parsed_t>();
+	parsed_sink_t<image_view_t>::parse(root_view(this -> _data, this -> _fallbacks), args, 0, p.get());
+	return p;
+}
+
+std::vector<std::string> usage_t::schema_t::suggest(const std::string& name, const std::vector<std::string>& command) const {
+
+	image_view_t v = root_view(this -> _data, this -> _fallbacks);
+
+	for ( const auto& c : command ) {
+
+		int i = v.command(c);
+		if ( i < 0 || !( v = v.child(i)))
+			return {};
+	}
+
+	return suggest_names(v, name);
+}
+
+// heap behind a string, if it outgrew its inline buffer
+static void count_string(const std::string& s, usage_t::schema_t::footprint_t& f) {
+
+	static const size_t inline_capacity = std::string().capacity();
+
+	if ( s.capacity() > inline_capacity ) {
+		f.usage_bytes += s.capacity() + 1;
+		f.usage_blocks++;
+	}
+}
+
+static void count_usage(const usage_t& u, usage_t::schema_t::footprint_t& f, std::vector<const usage_t*>& seen) {
+
+	if ( std::find(seen.begin(), seen.end(), &u) != seen.end())
+		return;
+
+	seen.push_back(&u);
+
+	for ( const std::string* s : { &u.info.name, &u.info.version_title, &u.info.version, &u.info.author_title,
+			&u.info.author, &u.info.copyright_title, &u.info.copyright, &u.info.usage_title, &u.info.usage,
+			&u.info.options_title, &u.info.description, &u.info.footer })
+		count_string(*s, f);
+
+	if ( u.options.capacity() != 0 ) {
+		f.usage_bytes += u.options.capacity() * sizeof(u.options.front());
+		f.usage_blocks++;
+	}
+
+	for ( const auto& opt : u.options )
+		for ( const std::string* s : { &opt.first, &opt.second.key, &opt.second.word, &opt.second.desc, &opt.second.name })
+			count_string(*s, f);
+
+	if ( u.positionals.capacity() != 0 ) {
+		f.usage_bytes += u.positionals.capacity() * sizeof(u.positionals.front());
+		f.usage_blocks++;
+	}
+
+	for ( const auto& slot : u.positionals ) {
+		count_string(slot.name, f);
+		count_string(slot.desc, f);
+	}
+
+	if ( u.commands.capacity() != 0 ) {
+		f.usage_bytes += u.commands.capacity() * sizeof(u.commands.front());
+		f.usage_blocks++;
+	}
+
+	for ( const auto& c : u.commands ) {
+
+		count_string(c.first, f);
+
+		if ( c.second ) { // make_shared: object and control block in one
+			f.usage_bytes += sizeof(usage_t) + 2 * sizeof(long);
+			f.usage_blocks++;
+			count_usage(*c.second, f, seen);
+		}
+	}
+}
+
+usage_t::schema_t::footprint_t usage_t::schema_t::footprint(const usage_t& usage) const {
+
+	usage_t::schema_t::footprint_t f;
+	std::vector<const usage_t*> seen;
+
+	f.usage_bytes = sizeof(usage_t);
+	count_usage(usage, f, seen);
+
+	f.image_bytes = this -> _size;
+	f.pool_bytes = ((const image_header_t*)this -> _data) -> pool;
+	return f;
+}
+
+std::ostream& operator <<(std::ostream& os, const usage_t::schema_t::footprint_t& footprint) {
+
+	os << "usage_t: " << footprint.usage_bytes << " bytes in " << footprint.usage_blocks + 1 << " blocks, " <<
+		"compiled: " << footprint.image_bytes << " bytes in 1 block (" << footprint.pool_bytes << " bytes of strings)";
+
+	if ( footprint.usage_bytes != 0 )
+		os << ", " << ( footprint.image_bytes * 100 / footprint.usage_bytes ) << "%";
+
+	return os;
+}
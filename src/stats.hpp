@@ -0,0 +1,28 @@
+#pragma once
+#include <chrono>
+
+#include "usage.hpp"
+
+// Parse instrumentation hooks. Built with -DUSAGE_STATS they feed
+// usage_t::stats(); otherwise USAGE_STAT() expands to nothing and the
+// parser carries no trace of them.
+
+#ifdef USAGE_STATS
+
+#define USAGE_STAT(x) x
+
+// adds the lifetime of its scope to a duration counter
+struct usage_stat_timer_t {
+
+	std::chrono::nanoseconds& into;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	usage_stat_timer_t(std::chrono::nanoseconds& d) : into(d) {}
+	~usage_stat_timer_t() { this -> into += std::chrono::steady_clock::now() - this -> start; }
+};
+
+#else
+
+#define USAGE_STAT(x)
+
+#endif
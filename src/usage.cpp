@@ -2,6 +2,8 @@
 #include <vector>
 #include <type_traits>
 #include <stdexcept>
+#include <cstdlib>
+#include <cerrno>
 
 #include "usage.hpp"
 
@@ -32,14 +34,9 @@ static std::string trim(const std::string& str) {
 	return _str;
 }
 
-template <typename K, typename V>
-static bool map_contains(const std::unordered_map<K, V>& _m, K val) {
-
-	return std::find_if(_m.begin(), _m.end(), [&val](const auto& p) { return p.first == val; }) != _m.end();
-}
-
 usage_t::args_t::args_t(const int argc, char **argv) {
 
+	this -> _argv = argv;
 	this -> _cmd = argv[0];
 	for ( int i = 1; i < argc; i++ )
 		this -> _vec.push_back(argv[i]);
@@ -60,6 +57,11 @@ std::string usage_t::args_t::cmd() const {
 	return this -> _cmd;
 }
 
+bool usage_t::args_t::marker(const std::string& name) const {
+
+	return !this -> _dispatched && !this -> _vec.empty() && this -> _vec.front() == name;
+}
+
 std::string usage_t::args_t::operator [](size_t index) const {
 
 	if ( index >= this -> _vec.size())
@@ -124,6 +126,66 @@ long usage_t::result_t::hexValue() const {
 	return res;
 }
 
+usage_t::bind_t::operator bool() const {
+	return this -> _kind != usage_t::bind_t::NONE;
+}
+
+bool usage_t::bind_t::assign(const std::string& value, usage_t::arg_type type) const {
+
+	if ( this -> _kind == usage_t::bind_t::CUSTOM )
+		return this -> _custom(value);
+
+	if ( this -> _kind == usage_t::bind_t::BOOL ) {
+
+		if ( value.empty()) {
+			*static_cast<bool*>(this -> _ptr) = true;
+			return true;
+		}
+
+		std::string v(to_lower(trim(value)));
+
+		if ( v == "true" || v == "1" || v == "yes" || v == "enabled" ) *static_cast<bool*>(this -> _ptr) = true;
+		else if ( v == "false" || v == "0" || v == "no" || v == "disabled" ) *static_cast<bool*>(this -> _ptr) = false;
+		else return false;
+		return true;
+	}
+
+	if ( this -> _kind == usage_t::bind_t::NONE || value.empty())
+		return true;
+
+	if ( this -> _kind == usage_t::bind_t::STRING ) {
+		*static_cast<std::string*>(this -> _ptr) = value;
+		return true;
+	}
+
+	// values have been checked against their type already: hex carries its 0x
+	const char* str = value.c_str();
+	char* end = nullptr;
+	int base = type == usage_t::arg_type::HEX ? 16 : 10;
+	errno = 0;
+
+	if ( this -> _kind == usage_t::bind_t::DOUBLE ) {
+		double d = std::strtod(str, &end);
+		if ( end == str || *end != 0 || errno != 0 )
+			return false;
+		*static_cast<double*>(this -> _ptr) = d;
+
+	} else if ( this -> _kind == usage_t::bind_t::INT64 ) {
+		long long l = std::strtoll(str, &end, base);
+		if ( end == str || *end != 0 || errno != 0 )
+			return false;
+		*static_cast<int64_t*>(this -> _ptr) = l;
+
+	} else if ( this -> _kind == usage_t::bind_t::UINT32 ) {
+		unsigned long long l = std::strtoull(str, &end, base);
+		if ( end == str || *end != 0 || errno != 0 || l > UINT32_MAX || value.front() == '-' )
+			return false;
+		*static_cast<uint32_t*>(this -> _ptr) = (uint32_t)l;
+	}
+
+	return true;
+}
+
 std::string usage_t::name() const {
 
 	return this -> info.name;
@@ -209,117 +271,43 @@ std::string usage_t::version() const {
 
 usage_t::result_t usage_t::operator [](const std::string& name) const {
 
-	auto values = this -> values();
-	if ( map_contains(values, name))
-		return { .enabled = true, .value = values[name] };
-	else return { .enabled = false };
-}
-
-usage_t::result_t usage_t::operator [](const char* name) const {
-	return this -> operator [](std::string(name));
-}
-
-std::string usage_t::value(const std::string& name) const {
-	auto values = this -> values();
-	return map_contains(values, name) ? values[name] : "";
-}
-
-std::string usage_t::help() const {
-
-	if ( this -> options.empty())
-		return "No options available for this program";
-
-	size_t ks = 0;
-	std::string s;
-
-	if ( !this -> info.usage_title.empty() || !this -> info.usage.empty()) {
-
-		if ( !this -> info.usage_title.empty())
-			s += this -> info.usage_title;
-
-		s += this -> args.cmd();
-
-		if ( !this -> info.usage.empty())
-			s += " " + this -> info.usage;
-
-		s += "\n";
-	}
-
-	if ( !this -> info.description.empty())
-		s += this -> info.description;
-
-	if ( !this -> info.options_title.empty())
-		s += this -> info.options_title;
-
-	// find size of shortest key
-	for ( auto it = this -> options.begin(); it != this -> options.end(); it++ ) {
-
-		if ( it -> first.empty() || ( it -> second.key.empty() && it -> second.word.empty()))
-			continue;
-
-		if ( !it -> second.key.empty() && ks < ( it -> second.key.size() + 1 ))
-			ks = it -> second.key.size() + 1;
-	}
-
-	// Build each option's left part (everything up to the description), measure
-	// the widest, then align every description to a common column. (Computing a
-	// width up front mis-counted the key-column padding, so long options ran into
-	// their descriptions.)
-	std::vector<std::pair<std::string, std::string>> rows;   // { left part, description }
-	size_t widest = 0;
+	if ( auto it = this -> validated.values.find(name); it != this -> validated.values.end())
+		return { .enabled = true, .value = it -> second };
 
-	for ( auto it = this -> options.begin(); it != this -> options.end(); it++ ) {
+	// not given: its fallback, worked out on first use
+	std::shared_ptr<const usage_t::fallbacks_t> fallbacks = this -> fallbacks();
 
-		if ( it -> first.empty() || ( it -> second.key.empty() && it -> second.word.empty()))
-			continue;
+	if ( auto it = fallbacks -> find(name); it != fallbacks -> end())
+		return { .enabled = false, .value = it -> second.fallback.value(it -> second.type) };
 
-		std::string row = "   ";
-
-		if ( !it -> second.key.empty()) {
-
-			row += "-" + it -> second.key;
-			if ( !it -> second.word.empty())
-				row += ", ";
-
-			while ( row.size() < ks + 5 )
-				row += " ";
-
-		} else while ( row.size() < ks + 5 )
-			row += ' ';
-
-		if ( !it -> second.word.empty())
-			row += "--" + it -> second.word;
+	return {};
+}
 
-		if ( it -> second.flag == usage_t::arg_flag::REQUIRED )
-			row += " <" + ( it -> second.name.empty() ? "arg" : it -> second.name ) + ">";
-		else if ( it -> second.flag == usage_t::arg_flag::OPTIONAL )
-			row += " [" + ( it -> second.name.empty() ? "arg" : it -> second.name ) + "]";
+std::shared_ptr<const usage_t::fallbacks_t> usage_t::fallbacks() const {
 
-		if ( row.size() > widest )
-			widest = row.size();
+	std::shared_ptr<const usage_t::fallbacks_t> index = std::atomic_load(&this -> fallback_index.ptr);
 
-		rows.push_back({ row, it -> second.desc });
-	}
+	if ( index )
+		return index;
 
-	for ( const auto& r : rows ) {
+	auto built = std::make_shared<usage_t::fallbacks_t>();
 
-		std::string row = r.first;
+	for ( const auto& opt : this -> options )
+		if ( opt.second.fallback )
+			built -> emplace(opt.first, usage_t::fallback_t{ .fallback = opt.second.fallback, .type = opt.second.type });
 
-		if ( !r.second.empty()) {
-			while ( row.size() < widest )
-				row += ' ';
-			row += "   " + r.second;   // gap between the option column and its description
-		}
-
-		if ( !s.empty())
-			s += '\n';
-		s += row;
-	}
+	// built by several threads at once: the first one stored is used
+	index = built;
+	std::shared_ptr<const usage_t::fallbacks_t> expected;
+	return std::atomic_compare_exchange_strong(&this -> fallback_index.ptr, &expected, index) ? index : expected;
+}
 
-	if ( !this -> info.footer.empty())
-		s += "\n" + this -> info.footer;
+usage_t::result_t usage_t::operator [](const char* name) const {
+	return this -> operator [](std::string(name));
+}
 
-	return s;
+std::string usage_t::value(const std::string& name) const {
+	return this -> operator [](name).value;
 }
 
 usage_t::operator std::string() const {
@@ -0,0 +1,53 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <cstdio>
+
+// Small helpers shared by the caches, the compiled schema and the renderers.
+
+// FNV-1a, fed piece by piece
+struct fnv1a_t {
+
+	uint64_t hash = 14695981039346656037ull;
+
+	void add(const unsigned char* data, size_t size) {
+
+		for ( size_t i = 0; i < size; i++ ) {
+			this -> hash ^= data[i];
+			this -> hash *= 1099511628211ull;
+		}
+	}
+
+	// a string followed by its length, so that neighbours differ:
+	// { "ab", "c" } is not { "a", "bc" }
+	void add(const std::string& s) {
+
+		this -> add((const unsigned char*)s.data(), s.size());
+
+		for ( size_t n = s.size(), i = 0; i < sizeof(n); i++, n >>= 8 ) {
+			this -> hash ^= n & 0xff;
+			this -> hash *= 1099511628211ull;
+		}
+	}
+};
+
+// s as a JSON string, quotes included
+inline std::string json_quote(const std::string& s) {
+
+	std::string r = "\"";
+
+	for ( unsigned char c : s ) {
+
+		if ( c == '"' ) r += "\\\"";
+		else if ( c == '\\' ) r += "\\\\";
+		else if ( c == '\n' ) r += "\\n";
+		else if ( c == '\t' ) r += "\\t";
+		else if ( c < 0x20 ) {
+			char buf[8];
+			std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+			r += buf;
+		} else r += c;
+	}
+
+	return r + "\"";
+}
@@ -3,509 +3,402 @@
 #include <type_traits>
 #include <stdexcept>
 #include <utility>
+#include <cstdint>
 
 #include "usage.hpp"
+#include "parser.hpp"
 
-static const std::string whitespace = " \t\n\r\f\v";
+std::unordered_map<std::string, std::string> usage_t::values() const {
+	return std::as_const(this -> validated.values);
+}
 
-static std::string l_trim(const std::string& str) {
+std::vector<usage_t::error_t> usage_t::errors() const {
 
-	std::string _str(str);
-	_str.erase(_str.find_last_not_of(whitespace) + 1);
-	return _str;
-}
+	std::vector<usage_t::error_t> errors;
+	errors.reserve(this -> validated.errors.size());
 
-static std::string trim(const std::string& str) {
+	for ( const auto& e : this -> validated.errors )
+		errors.push_back(make_error(usage_view_t{ this }, e.positional ? this -> validated.remainder : this -> args._vec, e));
 
-	std::string _str(l_trim(str));
-	_str.erase(0, _str.find_first_not_of(whitespace));
-	return _str;
+	return errors;
 }
 
-static std::string to_lower(const std::string& str) {
-
-	std::string _str(str);
+size_t usage_t::error_count() const {
+	return this -> validated.errors.size();
+}
 
-	for ( auto& ch : _str )
-		if ( std::isupper(ch))
-			ch ^= 32;
-	return _str;
+const usage_t::error_ref_t* usage_t::first_error() const {
+	return this -> validated.errors.empty() ? nullptr : &this -> validated.errors.front();
 }
 
-static bool has_prefix(const std::string& str, const std::string& prefix) {
+std::vector<std::string> usage_t::remainder() const {
+	return std::as_const(this -> validated.remainder);
+}
 
-	#if __cplusplus >= 202002L
-		return str.starts_with(prefix);
-	#else
-		return str.size() >= prefix.size() && str.substr(0, prefix.size()).compare(prefix) == 0;
-	#endif
+std::string usage_t::subcommand() const {
+	return std::as_const(this -> validated.command);
 }
 
-static bool is_number(const std::string& s) {
+usage_t* usage_t::sub() const {
+	return this -> validated.sub;
+}
 
-	return !s.empty() && s.find_first_not_of("1234567890") == std::string::npos;
+std::vector<std::string> usage_t::tail() const {
+	return std::as_const(this -> validated.tail);
 }
 
-static bool is_float(const std::string& s) {
+char* const* usage_t::passthrough() const {
+	return this -> validated.passthrough;
+}
 
-	if ( s.empty() || s.find_first_not_of("1234567890.") != std::string::npos || s.find_first_of("1234567890") == std::string::npos )
-		return false;
+size_t usage_t::validator_t::size() const {
+	return this -> values.size();
+}
 
-	if ( s.find_first_of('.') == std::string::npos )
-		return true;
+usage_t::validator_t::operator bool() const {
+	return this -> errors.empty();
+}
 
-	return std::count_if(s.begin(), s.end(), [](std::string::value_type ch) { return ch == '.'; }) < 2;
+bool usage_t::contains(const std::string& name) const {
+	return this -> validated.values.find(name) != this -> validated.values.end();
 }
 
-static bool is_hex(const std::string& s) {
+#ifdef USAGE_STATS
+usage_t::stats_t& usage_t::stats() {
 
-	return ( has_prefix(s, "0x") && s.size() > 2 &&
-		s.find_first_not_of("01234567890abcdefABCDEF", 2) == std::string::npos ) ||
-		( !s.empty() && s.find_first_not_of("01234567890abcdefABCDEF") == std::string::npos );
+	static thread_local usage_t::stats_t s;
+	return s;
 }
+#endif
+
+// stores what the parser meets into a validator_t, dispatching subcommands
+// to their own usage_t
+struct usage_t::validator_t::sink_t {
+
+	static constexpr bool binds = true;
+	static constexpr bool checkpoints = false;
 
-template <typename K, typename V>
-static bool map_contains(const std::unordered_map<K, V>& _m, K val) {
+	usage_t* u;
+	usage_t::validator_t* v;
+
+	void option(int idx, std::string&& value) {
+		this -> v -> values[this -> u -> options[idx].first] = std::move(value);
+	}
 
-	return std::find_if(_m.begin(), _m.end(), [&val](const auto& p) { return p.first == val; }) != _m.end();
+	void positional(std::string&& arg) {
+		this -> v -> remainder.push_back(std::move(arg));
+	}
+
+	void slot(size_t i, std::string&& value) {
+		this -> v -> values[this -> u -> positionals[i].name] = std::move(value);
+	}
+
+	void variadic(std::shared_ptr<usage_t::variadic_t>&& values) {
+		this -> v -> variadic = std::move(values);
+	}
+
+	void error(const usage_t::error_ref_t& e) {
+
+		// a failed argument drops its option, even if given earlier
+		if ( !e.positional && ( e.error == usage_t::error_type::ARG_VALIDATION || e.error == usage_t::error_type::MISSING_ARG ))
+			this -> v -> values.erase(this -> u -> options[e.option].first);
+
+		this -> v -> errors.push_back(e);
+	}
+
+	// hand the rest of the argument vector to the command's own usage_t (a
+	// null entry leaves them unparsed - see tail()); the command owns it
+	void command(size_t pos, const std::string& name, int c) {
+
+		const std::shared_ptr<usage_t>& target = this -> u -> commands[c].second;
+
+		this -> v -> command = name;
+		this -> v -> tail.assign(this -> u -> args._vec.begin() + pos + 1, this -> u -> args._vec.end());
+
+		if ( this -> u -> args._argv != nullptr )
+			this -> v -> passthrough = this -> u -> args._argv + pos + 1;
+
+		if ( target ) {
+
+			USAGE_STAT(usage_stat_timer_t _dispatch_timer(usage_t::stats().dispatch[name]));
+
+			target -> args._cmd = name;
+			target -> args._vec = this -> v -> tail;
+			target -> args._argv = this -> v -> passthrough;
+			target -> args._dispatched = true;
+			target -> validated = usage_t::validator_t(target.get());
+			this -> v -> sub = target.get();
+		}
+	}
+};
+
+usage_t::validator_t::validator_t(usage_t *u) {
+
+	USAGE_STAT(usage_stat_timer_t _parse_timer(usage_t::stats().parse));
+
+	check_slots(*u);
+
+	// hidden shell completion and export entry points (see usage_t::complete,
+	// usage_t::document): parse nothing
+	if ( u -> completing() || u -> exporting())
+		return;
+
+	// `prog __parse <format> [args..]` (see usage_t::scripting) parses the args
+	sink_t sink = { .u = u, .v = this };
+	parse_args(usage_view_t{ u }, u -> args._vec, u -> scripting() ? std::min<size_t>(2, u -> args._vec.size()) : 0, sink);
+
+	if ( this -> command.empty())
+		parse_positionals(usage_view_t{ u }, this -> remainder, sink);
+
+	USAGE_STAT(usage_t::stats().allocations += this -> values.size() + this -> errors.size() + this -> remainder.size() + this -> tail.size());
 }
 
-std::unordered_map<std::string, std::string> usage_t::values() const {
-	return std::as_const(this -> validated.values);
+// hands what the parser meets straight to user callbacks, following
+// subcommands into their own options
+struct handler_sink_t {
+
+	static constexpr bool binds = true;
+	static constexpr bool checkpoints = false;
+
+	const usage_t* u;
+	const usage_t::handler_t& h;
+	const std::vector<std::string>& args;
+	bool failed = false;
+	bool dispatched = false;              // u handed the rest to a command
+	std::vector<std::string> remainder;   // positionals of u, for its slots
+	std::vector<bool> given;              // options of u accepted, for fallbacks
+
+	void option(int idx, std::string&& value) {
+
+		this -> given[idx] = true;
+
+		if ( this -> h.option )
+			this -> h.option(this -> u -> options[idx].first, { .enabled = true, .value = std::move(value) });
+	}
+
+	void positional(std::string&& arg) {
+
+		if ( this -> h.positional )
+			this -> h.positional(arg);
+
+		if ( !this -> u -> positionals.empty())
+			this -> remainder.push_back(std::move(arg));
+	}
+
+	// a slot's value comes as an option by the slot's name
+	void slot(size_t i, std::string&& value) {
+
+		if ( this -> h.option )
+			this -> h.option(this -> u -> positionals[i].name, { .enabled = true, .value = std::move(value) });
+	}
+
+	void variadic(std::shared_ptr<usage_t::variadic_t>&&) {}   // its values came as positionals
+
+	void error(const usage_t::error_ref_t& e) {
+
+		this -> failed = true;
+
+		if ( !e.positional && ( e.error == usage_t::error_type::ARG_VALIDATION || e.error == usage_t::error_type::MISSING_ARG ))
+			this -> given[e.option] = false;
+
+		if ( this -> h.error )
+			this -> h.error(make_error(usage_view_t{ this -> u }, e.positional ? this -> remainder : this -> args, e));
+	}
+
+	// parses the arguments of u from first on, positional slots and fallbacks
+	// included
+	void parse(size_t first) {
+
+		this -> given.assign(this -> u -> options.size(), false);
+		this -> dispatched = false;
+		parse_args(usage_view_t{ this -> u }, this -> args, first, *this);
+
+		if ( !this -> dispatched )
+			parse_positionals(usage_view_t{ this -> u }, this -> remainder, *this);
+
+		if ( !this -> h.option )
+			return;
+
+		for ( size_t i = 0; i < this -> u -> options.size(); i++ ) {
+
+			const usage_t::option_t& opt = this -> u -> options[i].second;
+
+			if ( opt.fallback && !this -> given[i] )
+				this -> h.option(this -> u -> options[i].first, { .enabled = false, .value = opt.fallback.value(opt.type) });
+		}
+	}
+
+	void command(size_t pos, const std::string& name, int c) {
+
+		const std::shared_ptr<usage_t>& target = this -> u -> commands[c].second;
+
+		if ( this -> h.command )
+			this -> h.command(name, target.get());
+
+		if ( !target ) { // raw passthrough: its arguments, as they are
+			if ( this -> h.positional )
+				for ( size_t i = pos + 1; i < this -> args.size(); i++ )
+					this -> h.positional(this -> args[i]);
+			this -> dispatched = true;
+			return;
+		}
+
+		const usage_t* parent = this -> u;
+		std::vector<std::string> remainder = std::move(this -> remainder);
+		std::vector<bool> given = std::move(this -> given);
+
+		this -> u = target.get();
+		this -> remainder.clear();
+		this -> parse(pos + 1);
+
+		this -> u = parent;
+		this -> remainder = std::move(remainder);
+		this -> given = std::move(given);
+		this -> dispatched = true;
+	}
+};
+
+bool usage_t::parse(const usage_t::args_t& args, const usage_t::handler_t& h) const {
+
+	USAGE_STAT(usage_stat_timer_t _parse_timer(usage_t::stats().parse));
+
+	handler_sink_t sink = { .u = this, .h = h, .args = args._vec };
+	sink.parse(0);
+	return !sink.failed;
 }
 
-std::vector<usage_t::error_t> usage_t::errors() const {
-	return std::as_const(this -> validated.errors);
+std::shared_ptr<const usage_t::parsed_t> usage_t::parse(const std::vector<std::string>& args) const {
+
+	USAGE_STAT(usage_stat_timer_t _parse_timer(usage_t::stats().parse));
+
+	auto p = std::make_shared<usage_t::parsed_t>();
+	parsed_sink_t<usage_view_t>::parse(usage_view_t{ this }, args, 0, p.get());
+	return p;
 }
 
-std::vector<std::string> usage_t::remainder() const {
-	return std::as_const(this -> validated.remainder);
+usage_t::parsed_t::operator bool() const {
+	return this -> errors.empty();
 }
 
-std::string usage_t::subcommand() const {
-	return std::as_const(this -> validated.command);
+size_t usage_t::parsed_t::error_count() const {
+
+	size_t n = 0;
+
+	for ( const usage_t::parsed_t* level = this; level != nullptr; level = level -> sub.get())
+		n += level -> errors.size();
+
+	return n;
 }
 
-usage_t* usage_t::sub() const {
-	return this -> validated.sub;
+const usage_t::error_t* usage_t::parsed_t::first_error() const {
+
+	for ( const usage_t::parsed_t* level = this; level != nullptr; level = level -> sub.get())
+		if ( !level -> errors.empty())
+			return &level -> errors.front();
+
+	return nullptr;
 }
 
-std::vector<std::string> usage_t::tail() const {
-	return std::as_const(this -> validated.tail);
+usage_t::result_t usage_t::parsed_t::operator [](const std::string& name) const {
+
+	if ( auto it = this -> values.find(name); it != this -> values.end())
+		return { .enabled = true, .value = it -> second };
+
+	if ( this -> fallbacks != nullptr )
+		if ( auto f = this -> fallbacks -> find(name); f != this -> fallbacks -> end())
+			return { .enabled = false, .value = f -> second.fallback.value(f -> second.type) };
+
+	return {};
 }
 
-size_t usage_t::validator_t::size() const {
-	return this -> values.size();
+usage_t::result_t usage_t::parsed_t::operator [](const char* name) const {
+	return this -> operator [](std::string(name));
 }
 
-usage_t::validator_t::operator bool() const {
-	return this -> errors.empty();
+std::string usage_t::parsed_t::value(const std::string& name) const {
+	return this -> operator [](name).value;
 }
 
-bool usage_t::contains(const std::string& name) const {
-	return map_contains(this -> validated.values, name);
+usage_t::default_t::default_t(const char* value) : default_t(std::string(value)) {}
+
+usage_t::default_t::default_t(const std::string& value) : _state(std::make_shared<state_t>()) {
+
+	this -> _state -> value = value;
 }
 
-usage_t::validator_t::validator_t(usage_t *u) {
+usage_t::default_t::operator bool() const {
+	return this -> _state != nullptr;
+}
 
-	bool waiting_arg = false;
-	bool optional_arg = false;
-	bool parsing = true;
-	usage_t::arg_type arg_type = usage_t::arg_type::STRING;
-	std::string o;
+bool usage_t::default_t::callable() const {
+	return this -> _state != nullptr && this -> _state -> make != nullptr;
+}
 
-	for ( std::vector<std::string>::size_type _i = 0; _i < u -> args._vec.size(); _i++ ) {
+const std::string& usage_t::default_t::value(usage_t::arg_type type) const {
 
-		const std::string& s = u -> args._vec[_i];
+	static const std::string none;
 
-		if ( !parsing ) {
-			this -> remainder.push_back(s);
-			continue;
-		}
+	if ( !this -> _state )
+		return none;
 
-		std::string a(s);
-		std::string alt_name;
-		std::string alt_option;
-		std::string alt_value;
-		usage_t::arg_type alt_type = usage_t::arg_type::STRING;
-		bool alt = false;
-
-		if ( !waiting_arg && !optional_arg ) {
-
-			a = trim(a);
-
-			while ( has_prefix(a, "--") && a != "--" )
-				a.erase(0, 1);
+	state_t& s = *this -> _state;
 
-			if ( a.empty())
-				continue;
-
-			if ( a == "--" ) {
-				// explicit end-of-options marker: everything after is positional
-				parsing = false;
-				waiting_arg = false;
-				optional_arg = false;
-				arg_type = usage_t::arg_type::STRING;
-				o = "";
-				continue;
-			}
-
-			if ( !has_prefix(a, "-")) {
-
-				// subcommand dispatch: if this positional names a declared
-				// command, hand the rest of the argument vector to that
-				// command's own usage_t (a null entry leaves them unparsed -
-				// see tail()) and stop; the command owns what follows.
-				if ( !u -> commands.empty()) {
-
-					bool is_command = false;
-					std::shared_ptr<usage_t> target;
-
-					for ( const auto& c : u -> commands )
-						if ( a == c.first ) { is_command = true; target = c.second; break; }
-
-					if ( is_command ) {
-
-						this -> command = a;
-						this -> tail.assign(u -> args._vec.begin() + _i + 1, u -> args._vec.end());
-
-						if ( target ) {
-							target -> args._cmd = a;
-							target -> args._vec = this -> tail;
-							target -> validated = usage_t::validator_t(target.get());
-							this -> sub = target.get();
-						}
-
-						break;
-					}
-				}
-
-				// a positional argument; collect it but keep parsing options that
-				// follow, so `cmd <positional> --option` works (e.g. subcommands)
-				this -> remainder.push_back(a);
-				continue;
-			}
-
-			a.erase(0,1);
-			a = l_trim(a);
-
-			if ( a.empty())
-				continue;
-
-			if ( auto pos = a.find('='); pos != std::string::npos && a.at(0) != '0' ) {
-				alt_option = a.substr(0, pos);
-				alt_value = a.substr(pos, a.size() - pos);
-				if ( alt_value.front() == '=' )
-					alt_value.erase(0, 1);
-			}
-
-			bool valid = false;
-
-			for ( auto& opt : u -> options ) {
-				if ( a == opt.second.key || a == opt.second.word ) {
-					valid = true;
-					waiting_arg = opt.second.flag == usage_t::arg_flag::REQUIRED ? true : false;
-					optional_arg = opt.second.flag == usage_t::arg_flag::OPTIONAL ? true : false;
-					arg_type = opt.second.type;
-					o = opt.first;
-					break;
-				}
-			}
-
-			if ( !valid && !alt_option.empty()) {
-
-				for ( auto& opt : u -> options ) {
-
-					if (( alt_option == opt.second.key || alt_option == opt.second.word ) && ( opt.second.flag != usage_t::arg_flag::NO )) {
-						alt = true;
-						alt_type = opt.second.type;
-						alt_name = opt.first;
-						break;
-					}
-				}
-			}
-
-			if ( !valid && !alt ) {
-				this -> errors.push_back({ .name = ( alt_option.empty() ? a : alt_option ), .error = usage_t::error_type::UNKNOWN_OPTION });
-				continue;
-			}
+	// worked out once, and checked once for each type it is read as, even
+	// when asked for from several threads at once - copies share the state
+	std::call_once(s.once, [&s]() {
+		if ( s.make )
+			s.value = s.make();
+	});
 
-			if ( !alt ) {
-
-				if ( map_contains(this -> values, o))
-					this -> errors.push_back({ .name = o, .error = usage_t::error_type::DUPLICATE, .type = arg_type });
-
-				this -> values[o] = "";
-
-				continue;
-			}
-		}
+	std::call_once(s.checked[type], [&s, type]() {
+		s.typed[type] = s.value;
+		s.fits[type] = check_value(type, s.typed[type]);
+	});
 
-		if ( alt ) {
-
-			if ( map_contains(this -> values, alt_name))
-				this -> errors.push_back({ .name = alt_name, .error = usage_t::error_type::DUPLICATE, .type = alt_type });
-
-			if ( alt_type != usage_t::arg_type::STRING )
-				alt_value = trim(alt_value);
-
-			if ( alt_type == usage_t::arg_type::INT && !is_number(alt_value)) {
-				this -> errors.push_back({ .name = alt_name, .error = usage_t::error_type::ARG_VALIDATION, .type = alt_type, .value = alt_value });
-				if ( map_contains(this -> values, alt_name))
-					this -> values.erase(alt_name);
-				waiting_arg = false;
-				optional_arg = false;
-				arg_type = usage_t::arg_type::STRING;
-				o = "";
-				continue;
-			} else if ( alt_type == usage_t::arg_type::FLOAT && !is_float(alt_value)) {
-				this -> errors.push_back({ .name = alt_name, .error = usage_t::error_type::ARG_VALIDATION, .type = alt_type, .value = alt_value });
-				if ( map_contains(this -> values, alt_name))
-					this -> values.erase(alt_name);
-				waiting_arg = false;
-				optional_arg = false;
-				arg_type = usage_t::arg_type::STRING;
-				o = "";
-				continue;
-                        } else if ( alt_type == usage_t::arg_type::HEX ) {
-
-                                std::string v(alt_value);
-
-				if ( v.size() > 1 && v.front() == '#' && std::isdigit(v.at(1))) {
-					v.erase(0, 1);
-					v = "0x" + v;
-				} else if ( v.size() > 1 && v.front() == 'x' )
-					v = "0" + v;
-				else if ( !has_prefix(v, "0x"))
-					v = "0x" + v;
-
-				if ( !is_hex(v)) {
-					this -> errors.push_back({ .name = alt_name, .error = usage_t::error_type::ARG_VALIDATION, .type = alt_type, .value = alt_value });
-					if ( map_contains(this -> values, alt_name))
-						this -> values.erase(alt_name);
-					waiting_arg = false;
-					optional_arg = false;
-					arg_type = usage_t::arg_type::STRING;
-					o = "";
-					continue;
-				} else alt_value = v;
-
-
-			} else if ( alt_type == usage_t::arg_type::BOOL ) {
-
-				std::string v(to_lower(alt_value));
-				if ( v == "0" || v == "no" || v == "disabled" ) v = "false";
-				else if ( v == "1" || v == "yes" || v == "enabled" ) v = "true";
-
-				if ( v != "false" && v != "true" ) {
-					this -> errors.push_back({ .name = alt_name, .error = usage_t::error_type::ARG_VALIDATION, .type = alt_type, .value = alt_value });
-					if ( map_contains(this -> values, alt_name))
-						this -> values.erase(alt_name);
-					waiting_arg = false;
-					optional_arg = false;
-					arg_type = usage_t::arg_type::STRING;
-					o = "";
-					continue;
-				} else a = v;
-			}
-
-			this -> values[alt_name] = alt_value;
-			waiting_arg = false;
-			optional_arg = false;
-			arg_type = usage_t::arg_type::STRING;
-			o = "";
-			continue;
-		}
+	if ( !s.fits[type] )
+		throw std::invalid_argument("fallback value '" + s.value + "' does not fit its option's type");
 
-		if ( o.empty() || alt ) {
+	return s.typed[type];
+}
 
-			waiting_arg = false;
-			optional_arg = false;
-			arg_type = usage_t::arg_type::STRING;
-			continue;
-		}
+std::vector<std::string> usage_t::suggest(const std::string& name) const {
+	return suggest_names(usage_view_t{ this }, name);
+}
 
-		if ( waiting_arg ) {
-
-			if ( arg_type != usage_t::arg_type::STRING )
-				a = trim(a);
-
-			if ( arg_type == usage_t::arg_type::INT && !is_number(a)) {
-				this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-				this -> values.erase(o);
-				waiting_arg = false;
-				optional_arg = false;
-				arg_type = usage_t::arg_type::STRING;
-				o = "";
-				continue;
-			} else if ( arg_type == usage_t::arg_type::FLOAT && !is_float(a)) {
-				this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-				this -> values.erase(o);
-				waiting_arg = false;
-				optional_arg = false;
-				arg_type = usage_t::arg_type::STRING;
-				o = "";
-				continue;
-			} else if ( arg_type == usage_t::arg_type::HEX ) {
-
-				std::string v(a);
-
-				if ( v.size() > 1 && v.front() == '#' && std::isdigit(v.at(1))) {
-					v.erase(0, 1);
-					v = "0x" + v;
-				} else if ( v.size() > 1 && v.front() == 'x' )
-					v = "0" + v;
-				else if ( !has_prefix(v, "0x"))
-					v = "0x" + v;
-
-				if ( !is_hex(v)) {
-					this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-					this -> values.erase(o);
-					waiting_arg = false;
-					optional_arg = false;
-					arg_type = usage_t::arg_type::STRING;
-					o = "";
-					continue;
-				} else a = v;
-			} else if ( arg_type == usage_t::arg_type::BOOL ) {
-
-				std::string v(to_lower(a));
-				if ( v == "0" || v == "no" || v == "disabled" ) v = "false";
-				else if ( v == "1" || v == "yes" || v == "enabled" ) v = "true";
-
-				if ( v != "false" && v != "true" ) {
-					this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-					this -> values.erase(o);
-					waiting_arg = false;
-					optional_arg = false;
-					arg_type = usage_t::arg_type::STRING;
-					o = "";
-					continue;
-				} else a = v;
-			}
-
-			this -> values[o] = a;
-
-		} else if ( optional_arg ) {
-
-			std::string v(trim(a));
-
-			while ( has_prefix(v, "--") && v != "--" )
-				v.erase(0, 1);
-
-			if ( !v.empty() && has_prefix(v, "-")) {
-
-				v.erase(0,1);
-				v = l_trim(v);
-
-				if ( !v.empty()) {
-
-					bool valid = false;
-					std::string _o = o;
-
-					for ( auto& opt : u -> options ) {
-						if ( v == opt.second.key || v == opt.second.word ) {
-							valid = true;
-							waiting_arg = opt.second.flag == usage_t::arg_flag::REQUIRED ? true : false;
-							optional_arg = opt.second.flag == usage_t::arg_flag::OPTIONAL ? true : false;
-							arg_type = opt.second.type;
-							o = opt.first;
-							break;
-						}
-					}
-
-					if ( valid && o != _o ) {
-
-						if ( map_contains(this -> values, o))
-							this -> errors.push_back({ .name = o, .error = usage_t::error_type::DUPLICATE, .type = arg_type });
-
-						this -> values[o] = "";
-						continue;
-					}
-				}
-			}
-
-			if ( arg_type != usage_t::arg_type::STRING )
-				a = trim(a);
-
-			if ( arg_type == usage_t::arg_type::INT && !is_number(a)) {
-				this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-				this -> values.erase(o);
-				waiting_arg = false;
-				optional_arg = false;
-				arg_type = usage_t::arg_type::STRING;
-				o = "";
-				continue;
-			} else if ( arg_type == usage_t::arg_type::FLOAT && !is_float(a)) {
-				this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-				this -> values.erase(o);
-				waiting_arg = false;
-				optional_arg = false;
-				arg_type = usage_t::arg_type::STRING;
-				o = "";
-				continue;
-			} else if ( arg_type == usage_t::arg_type::HEX ) {
-
-				std::string v(a);
-
-				if ( v.size() > 1 && v.front() == '#' && std::isdigit(v.at(1))) {
-					v.erase(0, 1);
-					v = "0x" + v;
-				} else if ( v.size() > 1 && v.front() == 'x' )
-					v = "0" + v;
-				else if ( !has_prefix(v, "0x"))
-					v = "0x" + v;
-
-				if ( !is_hex(v)) {
-					this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-					this -> values.erase(o);
-					waiting_arg = false;
-					optional_arg = false;
-					arg_type = usage_t::arg_type::STRING;
-					o = "";
-					continue;
-				} else a = v;
-			} else if ( arg_type == usage_t::arg_type::BOOL ) {
-
-				std::string v(to_lower(a));
-				if ( v == "0" || v == "no" || v == "disabled" ) v = "false";
-				else if ( v == "1" || v == "yes" || v == "enabled" ) v = "true";
-
-				if ( v != "false" && v != "true" ) {
-					this -> errors.push_back({ .name = o, .error = usage_t::error_type::ARG_VALIDATION, .type = arg_type, .value = a });
-					this -> values.erase(o);
-					waiting_arg = false;
-					optional_arg = false;
-					arg_type = usage_t::arg_type::STRING;
-					o = "";
-					continue;
-				} else a = v;
-			}
-
-			this -> values[o] = a;
-		}
+std::vector<std::string> usage_t::suggest(const usage_t::error_t& e) const {
 
-		waiting_arg = false;
-		optional_arg = false;
-		arg_type = usage_t::arg_type::STRING;
-		o = "";
+	if ( e.error != usage_t::error_type::UNKNOWN_OPTION )
+		return {};
 
-	}
+	return this -> suggest(e.name);
+}
 
-	if ( !o.empty() && waiting_arg ) {
-		this -> errors.push_back({ .name = o, .error = usage_t::error_type::MISSING_ARG, .type = arg_type });
-		this -> values.erase(o);
-	}
+usage_t::explained_t usage_t::explain(const std::vector<usage_t::error_t>& errors) const {
+	return { .usage = *this, .errors = errors };
 }
 
-std::ostream& operator <<(std::ostream& os, const std::vector<usage_t::error_t>& errors) {
+// errors as printed; owner, if any, suggests names for unknown options
+static void print_errors(std::ostream& os, const std::vector<usage_t::error_t>& errors, const usage_t* owner) {
 
 	for ( auto &e : errors ) {
 
 		os << " --" << e.name << ": ";
 
 		if ( e.error == usage_t::error_type::DUPLICATE ) os << "duplicated option";
-		else if ( e.error == usage_t::error_type::UNKNOWN_OPTION ) os << "unknown option";
+		else if ( e.error == usage_t::error_type::UNKNOWN_OPTION ) {
+
+			os << "unknown option";
+
+			std::vector<std::string> suggestions;
+			if ( owner != nullptr )
+				suggestions = owner -> suggest(e);
+
+			for ( size_t i = 0; i < suggestions.size(); i++ )
+				os << ( i == 0 ? ", did you mean " : i + 1 == suggestions.size() ? " or " : ", " ) << suggestions[i];
+
+			if ( !suggestions.empty())
+				os << "?";
+		}
 		else if ( e.error == usage_t::error_type::MISSING_ARG ) os << "missing required arg";
 		else if ( e.error == usage_t::error_type::ARG_VALIDATION ) {
 			os << "validation failure, expected ";
@@ -519,7 +412,17 @@ std::ostream& operator <<(std::ostream& os, const std::vector<usage_t::error_t>&
 				os << ", got " << e.value;
 		}
 	}
+}
+
+std::ostream& operator <<(std::ostream& os, const std::vector<usage_t::error_t>& errors) {
+
+	print_errors(os, errors, nullptr);
+	return os;
+}
+
+std::ostream& operator <<(std::ostream& os, const usage_t::explained_t& errors) {
 
+	print_errors(os, errors.errors, &errors.usage);
 	return os;
 }
 
@@ -0,0 +1,202 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "usage.hpp"
+#include "test.hpp"
+
+// Output checks, run by `make test`: what usage_t writes for others to read -
+// completion candidates, help, exported documents and script results.
+
+static usage_t schema(usage_t::args_t args = {}) {
+
+	return usage_t{
+		.args = args,
+		.options = {
+			{ "name", { .key = "n", .word = "name", .flag = usage_t::REQUIRED }},
+			{ "all", { .key = "a" }},
+			{ "verbose", { .key = "v", .word = "verbose" }},
+			{ "count", { .key = "c", .flag = usage_t::REQUIRED, .type = usage_t::INT }}
+		},
+		.commands = {
+			{ "greet", std::make_shared<usage_t>(usage_t{ .options = {{ "loud", { .key = "l", .word = "loud" }}}}) },
+			{ "raw", nullptr }
+		}
+	};
+}
+
+static std::string joined(const std::vector<std::string>& v) {
+
+	std::string s;
+
+	for ( const auto& w : v )
+		s += ( s.empty() ? "" : " " ) + w;
+	return s;
+}
+
+// candidates for the last word, the words before it read as parse_args does
+static void expect_completion(const std::vector<std::string>& words, const std::string& expected) {
+
+	static usage_t u = schema();
+
+	if ( std::string got = joined(u.complete(words)); got != expected )
+		fail("complete " + argv_t(words).str() + ": '" + got + "' (expected '" + expected + "')");
+}
+
+// help wrapped to a width stays within it, and is kept until dropped
+static void expect_help() {
+
+	usage_t u = { .options = {
+		{ "name", { .key = "n", .word = "name", .desc = "the name to greet, as it should be written in the greeting", .flag = usage_t::REQUIRED }}
+	}};
+
+	std::string wrapped = u.help(40);
+	size_t column = 0;
+
+	for ( char c : wrapped ) {
+		column = c == '\n' ? 0 : column + 1;
+		if ( column > 40 ) {
+			fail("help(40): a line is longer:\n" + wrapped);
+			break;
+		}
+	}
+
+	if ( wrapped.find("greeting") == std::string::npos || u.help(0) != u.help())
+		fail("help(40): '" + wrapped + "'");
+
+	u.options[0].second.desc = "who";
+
+	if ( u.help(40) != wrapped )
+		fail("help(40): rendered again before invalidate_help()");
+
+	u.invalidate_help();
+
+	if ( u.help(40).find("who") == std::string::npos )
+		fail("help(40): not rendered again after invalidate_help()");
+
+	// more widths than are kept start over
+	u.options[0].second.desc = "whom";
+
+	for ( size_t width = 41; width < 60; width++ )
+		u.help(width);
+
+	if ( u.help(40).find("whom") == std::string::npos )
+		fail("help(40): kept past the widths kept");
+}
+
+// exported documents: a subcommand's man page titled by one .TH argument,
+// Markdown text that cannot start emphasis or end a code span
+static void expect_document() {
+
+	argv_t argv({});
+	usage_t u = {
+		.args = argv,
+		.options = {{ "all", { .key = "a", .word = "all_files", .desc = "use *all* `files`" }}},
+		.commands = {{ "greet", std::make_shared<usage_t>(usage_t{ .options = {{ "tick", { .key = "`" }}}}) }}
+	};
+
+	std::string man = u.document(usage_t::MAN, { "greet" });
+	std::string md = u.document(usage_t::MARKDOWN);
+
+	if ( man.rfind(".TH \"TEST\\-GREET\" 1 ", 0) != 0 )
+		fail("document, man title: '" + man.substr(0, man.find('\n')) + "'");
+
+	// text is escaped, a code span holding a backtick gets a longer fence
+	for ( const char* line : { "- `-a, --all_files`: use \\*all\\* \\`files\\`", "- `` -` ``" })
+		if ( md.find(line) == std::string::npos )
+			fail("document, markdown: no '" + std::string(line) + "' in\n" + md);
+}
+
+// script results: sh assignments that fail eval on errors, at any level,
+// and JSON with its strings escaped
+static void expect_result(const std::vector<std::string>& args, const std::string& format, const std::string& expected) {
+
+	argv_t argv(args);
+	usage_t u = schema(argv);
+
+	if ( std::string got = u.result(format); got != expected )
+		fail("result " + format + " " + argv.str() + ": '" + got + "' (expected '" + expected + "')");
+}
+
+// a script through loop_t, what it writes back
+static std::string looped(const usage_t::loop_t& loop, const std::string& script) {
+
+	int in[2], out[2];
+
+	if ( pipe(in) != 0 || pipe(out) != 0 )
+		return "(no pipe)";
+
+	if ( write(in[1], script.data(), script.size()) != (ssize_t)script.size())
+		return "(short write)";
+
+	close(in[1]);
+	loop.run(in[0], out[1]);
+	close(in[0]);
+	close(out[1]);
+
+	std::string s;
+	char buf[4096];
+
+	for ( ssize_t n; ( n = read(out[0], buf, sizeof(buf))) > 0; )
+		s.append(buf, n);
+
+	close(out[0]);
+	return s;
+}
+
+// a line with an error at any command level is not handed to its command
+static void expect_loop() {
+
+	usage_t u = {
+		.options = {{ "verbose", { .key = "V" }}},
+		.commands = {{ "set", std::make_shared<usage_t>(usage_t{ .options = {
+			{ "key", { .key = "k", .flag = usage_t::REQUIRED }},
+			{ "value", { .key = "v", .flag = usage_t::REQUIRED, .type = usage_t::INT }}
+		}}) }}
+	};
+
+	auto set = [](const usage_t::parsed_t& r, std::string& out) { out += "set " + r.sub -> value("key") + "\n"; };
+	usage_t::loop_t printing = { .schema = &u, .commands = {{ "set", set }}};
+	std::string script = "set -k a -v 1\nset -k b -v abc\n-x set -k c\n";
+
+	if ( std::string got = looped(printing, script); got != "set a\nset: --value: validation failure, expected integer number, got abc\n-x: --x: unknown option\n" )
+		fail("loop: '" + got + "'");
+
+	usage_t::loop_t counting = printing;
+	counting.error = [](const usage_t::parsed_t& r, std::string& out) { out += "error\n"; };
+
+	if ( std::string got = looped(counting, script); got != "set a\nerror\nerror\n" )
+		fail("loop, error handler: '" + got + "'");
+}
+
+int main() {
+
+	expect_completion({ "g" }, "greet");
+	expect_completion({ "greet", "-" }, "-l --loud");
+
+	// after --, only positionals
+	expect_completion({ "--", "g" }, "");
+	expect_completion({ "--", "-" }, "");
+
+	// a bundle ending with an option that requires an argument takes the next
+	// word; an attached value does not
+	expect_completion({ "-an", "g" }, "");
+	expect_completion({ "-avn", "g" }, "");
+	expect_completion({ "-an", "x", "g" }, "greet");
+	expect_completion({ "-nx", "g" }, "greet");
+	expect_completion({ "-n=x", "g" }, "greet");
+	expect_completion({ "--name=x", "g" }, "greet");
+	expect_completion({ "--name", "g" }, "");
+
+	expect_result({ "-n", "x\"y", "z" }, "sh", "usage_name='x\"y'\nusage__errors=0\nset -- 'z'\n");
+	expect_result({ "-c", "q" }, "sh", "usage__errors=1\nusage__error_1='--count: validation failure, expected integer number, got q'\nset --\nfalse\n");
+	expect_result({ "greet", "--x" }, "sh", "usage__errors=0\nusage__command='greet'\nusage_greet__errors=1\nusage_greet__error_1='--x: unknown option'\nset --\nfalse\n");
+	expect_result({ "-n", "x\"y\n" }, "json", "{\"values\":{\"name\":\"x\\\"y\\n\"},\"remainder\":[],\"errors\":[]}\n");
+
+	expect_help();
+	expect_document();
+	expect_loop();
+
+	return report();
+}
@@ -0,0 +1,466 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <sstream>
+#include <functional>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <cstdio>
+#include <unistd.h>
+
+#include "usage.hpp"
+#include "test.hpp"
+
+// Parser checks, run by `make test`: command lines parsed through
+// usage_t::parse(args), a compiled schema and the other entry points, or into
+// bound variables, against the values and errors expected.
+
+static usage_t schema() {
+
+	return usage_t{
+		.options = {
+			{ "output", { .key = "o", .word = "output", .flag = usage_t::REQUIRED }},
+			{ "define", { .key = "D", .flag = usage_t::REQUIRED }},
+			{ "all", { .key = "a" }},
+			{ "brief", { .key = "b" }},
+			{ "name", { .key = "n", .word = "name", .flag = usage_t::REQUIRED }}
+		}
+	};
+}
+
+static void check(const std::string& what, const usage_t::parsed_t& p, const std::string& option, const std::string& value, size_t errors) {
+
+	auto it = p.values.find(option);
+	std::string got = it == p.values.end() ? "(none)" : it -> second;
+
+	if ( got != value || p.errors.size() != errors )
+		fail(what + ": " + option + " = " + got + ", " + std::to_string(p.errors.size()) + " errors" +
+			" (expected " + value + ", " + std::to_string(errors) + ")");
+}
+
+static void expect(const std::vector<std::string>& args, const std::string& option, const std::string& value, size_t errors = 0) {
+
+	static usage_t u = schema();
+	static auto compiled = usage_t::schema_t::compile(u);
+
+	std::string what = argv_t(args).str();
+
+	check(what, *u.parse(args), option, value, errors);
+	check(what + " (compiled)", *compiled -> parse(args), option, value, errors);
+}
+
+// a bound variable is written only with the value finally accepted
+static void expect_bound(const std::vector<std::string>& args, int64_t value) {
+
+	int64_t count = -1;
+	argv_t argv(args);
+
+	usage_t u = {
+		.args = argv,
+		.options = {{ "count", { .key = "c", .flag = usage_t::REQUIRED, .type = usage_t::INT, .bind = count }}}
+	};
+
+	if ( count != value || u.contains("count") != ( value != -1 ))
+		fail("bound " + argv.str() + ": count = " + std::to_string(count) + " (expected " + std::to_string(value) + ")");
+}
+
+// positional slots are checked the same way by every entry point
+static void expect_slots(const std::vector<std::string>& args, size_t errors) {
+
+	auto slots = [](usage_t::args_t args) {
+		return usage_t{
+			.args = args,
+			.positionals = {{ .name = "file" }, { .name = "count", .type = usage_t::INT }, { .name = "rest", .type = usage_t::FLOAT, .variadic = true }}
+		};
+	};
+
+	argv_t argv(args);
+	std::vector<size_t> found = { slots(argv).error_count() };
+
+	for ( const auto& p : results(slots, args))
+		found.push_back(p -> errors.size());
+
+	for ( size_t n : found )
+		if ( n != errors ) {
+			fail("slots " + argv.str() + ": " + std::to_string(n) + " errors (expected " + std::to_string(errors) + ")");
+			break;
+		}
+}
+
+// one fallback shared by options of different types is checked, and
+// normalised, for each of them
+static void expect_shared_fallback() {
+
+	usage_t::default_t shared = "ff";
+	usage_t u = { .options = {
+		{ "text", { .key = "t", .flag = usage_t::REQUIRED, .fallback = shared }},
+		{ "mask", { .key = "m", .flag = usage_t::REQUIRED, .type = usage_t::HEX, .fallback = shared }},
+		{ "count", { .key = "c", .flag = usage_t::REQUIRED, .type = usage_t::INT, .fallback = shared }}
+	}};
+
+	if ( u.value("text") != "ff" || u.value("mask") != "0xff" || u.value("text") != "ff" )
+		fail("shared fallback: text = " + u.value("text") + ", mask = " + u.value("mask"));
+
+	try {
+		u["count"];
+		fail("shared fallback: accepted as INT");
+	} catch ( const std::invalid_argument& ) {}
+}
+
+// a command takes the positionals after it: the slots of the level that
+// dispatched it are not checked
+static void expect_dispatched_slots() {
+
+	auto dispatching = [](usage_t::args_t args) {
+		return usage_t{
+			.args = args,
+			.commands = {{ "run", std::make_shared<usage_t>() }, { "raw", nullptr }},
+			.positionals = {{ .name = "file" }}
+		};
+	};
+
+	for ( const std::vector<std::string>& args : std::vector<std::vector<std::string>>{{ "run" }, { "raw", "x" }}) {
+
+		argv_t argv(args);
+		std::vector<size_t> found = { dispatching(argv).error_count() };
+		bool handled = dispatching({}).parse(argv, {});
+
+		for ( const auto& p : results(dispatching, args))
+			found.push_back(p -> errors.size());
+
+		for ( size_t n : found )
+			if ( n != 0 || !handled ) {
+				fail("dispatched slots " + argv.str() + ": " + std::to_string(n) + " errors (expected 0)");
+				break;
+			}
+	}
+}
+
+// slots no parse can fill as declared are refused with the schema
+static void expect_refused_slots() {
+
+	std::vector<std::pair<std::string, std::function<usage_t()>>> schemas = {
+		{ "variadic not last", []() { return usage_t{ .positionals = {{ .name = "rest", .variadic = true }, { .name = "file" }}}; }},
+		{ "named as an option", []() { return usage_t{ .options = {{ "file", { .key = "f" }}}, .positionals = {{ .name = "file" }}}; }}
+	};
+
+	for ( const auto& s : schemas )
+		try {
+			s.second();
+			fail("slots " + s.first + ": accepted");
+		} catch ( const std::invalid_argument& ) {}
+}
+
+// a raw command's slice of argv: argv itself, from the command on
+static void expect_passthrough(const std::vector<std::string>& args, int from) {
+
+	argv_t argv(args);
+	usage_t u = {
+		.args = argv,
+		.options = {{ "all", { .key = "a" }}},
+		.commands = {{ "raw", nullptr }}
+	};
+
+	char* const* got = u.passthrough();
+	char* const* expected = from < 0 ? nullptr : argv.argv.data() + from;
+
+	if ( got != expected )
+		fail("passthrough " + argv.str() + ": " + ( got == nullptr ? "(none)" : got[0] ) + " at " +
+			std::to_string(got == nullptr ? -1 : got - argv.argv.data()) + " (expected " + std::to_string(from) + ")");
+}
+
+// cache_t: a hit hands back the result kept, the least recently used one
+// goes when it is full, and arguments split differently are told apart
+static void expect_cache() {
+
+	usage_t u = schema();
+	usage_t::cache_t cache(u, 2);
+
+	auto a = cache.parse({ "-o", "a" });
+	bool kept = cache.parse({ "-o", "a" }) == a;
+
+	cache.parse({ "-ob", "c" });
+	cache.parse({ "-o", "bc" });
+	bool evicted = cache.parse({ "-o", "a" }) != a;
+
+	if ( !kept || !evicted || cache.size() != 2 || cache.hits() != 1 || cache.misses() != 4 )
+		fail("cache: kept " + std::to_string(kept) + ", evicted " + std::to_string(evicted) + ", " + std::to_string(cache.size()) +
+			" entries, " + std::to_string(cache.hits()) + " hits, " + std::to_string(cache.misses()) + " misses");
+
+	if ( cache.parse({ "-ob", "c" }) -> values.at("output") != "b" || cache.parse({ "-o", "bc" }) -> values.at("output") != "bc" )
+		fail("cache: arguments split differently share a result");
+}
+
+// handle_t: an update is seen by the parses after it, never by a snapshot
+// taken before, nor by a reader parsing while it is made
+static void expect_handle() {
+
+	usage_t::handle_t h(std::make_shared<const usage_t>(schema()));
+	auto before = h.snapshot();
+	auto old = h.parse({ "--extra" });
+
+	h.update([](usage_t& s) { s.options.push_back({ "extra", { .word = "extra", .fallback = "none" }}); });
+
+	if ( old -> errors.size() != 1 || before -> parse({ "--extra" }) -> errors.size() != 1 ||
+		h.parse({ "--extra" }) -> errors.size() != 0 || h.parse({}) -> value("extra") != "none" || before -> options.size() != 5 )
+		fail("handle: an update reached a snapshot taken before it, or missed a parse after it");
+
+	std::atomic<bool> done = false;
+	std::atomic<size_t> failed = 0;
+
+	std::thread reader([&h, &done, &failed]() {
+		while ( !done )
+			if ( auto r = h.parse({ "-o", "x", "--extra" }); !r -> errors.empty() || r -> value("output") != "x" )
+				failed++;
+	});
+
+	for ( int i = 0; i < 200; i++ )
+		h.update([i](usage_t& s) { s.options.push_back({ "opt" + std::to_string(i), { .word = "opt" + std::to_string(i) }}); });
+
+	done = true;
+	reader.join();
+
+	if ( failed != 0 || h.snapshot() -> options.size() != 206 )
+		fail("handle: " + std::to_string(failed) + " parses failed while updating");
+}
+
+// a schema file as load() finds it: written whole it parses as compiled;
+// truncated, changed, of another source or missing it is refused
+static void expect_image() {
+
+	std::string path = "/tmp/usage_test_" + std::to_string(getpid()) + ".schema";
+	auto compiled = usage_t::schema_t::compile(schema(), 7);
+
+	auto image = [&path]() {
+		std::ifstream in(path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(in), {});
+	};
+
+	auto rewrite = [&path](const std::string& data) {
+		std::ofstream(path, std::ios::binary | std::ios::trunc) << data;
+	};
+
+	if ( !compiled -> write(path))
+		fail("image: not written to " + path);
+
+	auto loaded = usage_t::schema_t::load(path, 7);
+
+	if ( !loaded || loaded -> hash() != compiled -> hash() || loaded -> parse({ "-o", "x" }) -> value("output") != "x" )
+		fail("image: not loaded as written");
+
+	if ( usage_t::schema_t::load(path, 8))
+		fail("image: loaded for another source");
+
+	std::string whole = image();
+
+	rewrite(whole.substr(0, whole.size() - 1));
+	if ( usage_t::schema_t::load(path, 7))
+		fail("image: loaded truncated");
+
+	for ( size_t at : { (size_t)0, whole.size() / 2, whole.size() - 1 }) {
+
+		std::string changed = whole;
+		changed[at] ^= 0x20;
+		rewrite(changed);
+
+		if ( usage_t::schema_t::load(path, 7))
+			fail("image: loaded with byte " + std::to_string(at) + " changed");
+	}
+
+	std::remove(path.c_str());
+
+	if ( usage_t::schema_t::load(path, 7))
+		fail("image: loaded a missing file");
+}
+
+// fallbacks come from every entry point, a callback's worked out once, and
+// one that does not fit its option's type is refused
+static void expect_fallback(const std::vector<std::string>& args, const std::string& value) {
+
+	int calls = 0;
+	usage_t::default_t port = [&calls]() { calls++; return std::string(" 8080 "); };
+
+	auto fallbacks = [&port](usage_t::args_t args) {
+		return usage_t{
+			.args = args,
+			.options = {
+				{ "port", { .key = "p", .flag = usage_t::REQUIRED, .type = usage_t::INT, .fallback = port }},
+				{ "mode", { .key = "m", .flag = usage_t::REQUIRED, .type = usage_t::HEX, .fallback = "ff" }}
+			}
+		};
+	};
+
+	argv_t argv(args);
+	usage_t u = fallbacks(argv);
+	std::string handled;
+
+	fallbacks({}).parse(argv, { .option = [&handled](const std::string& name, const usage_t::result_t& r) {
+		if ( name == "port" ) handled = r.value;
+	}});
+
+	std::vector<std::string> found = { u.value("port"), handled };
+
+	for ( const auto& p : results(fallbacks, args))
+		found.push_back(p -> value("port"));
+
+	for ( const auto& v : found )
+		if ( v != value || calls != ( args.empty() ? 1 : 0 ) || u["mode"].value != "0xff" ) {
+			fail("fallback " + argv.str() + ": port = " + v + ", " + std::to_string(calls) + " calls (expected " + value + ")");
+			break;
+		}
+
+	usage_t bad = { .options = {{ "bad", { .key = "b", .flag = usage_t::REQUIRED, .type = usage_t::INT, .fallback = []() { return std::string("x"); }}}}};
+
+	try {
+		bad["bad"];
+		fail("fallback: an invalid one is accepted");
+	} catch ( const std::invalid_argument& ) {}
+}
+
+// a result's errors counted down its subcommands; the enums print as numbers
+static void expect_error_count() {
+
+	usage_t u = {
+		.options = {{ "all", { .key = "a" }}},
+		.commands = {{ "set", std::make_shared<usage_t>(usage_t{ .options = {{ "count", { .key = "c", .flag = usage_t::REQUIRED, .type = usage_t::INT }}}}) }}
+	};
+
+	auto p = u.parse({ "-x", "set", "-c", "abc", "-y" });
+	std::ostringstream os;
+
+	if ( const usage_t::error_t* e = p -> first_error(); e != nullptr )
+		os << e -> error << " " << e -> type;
+
+	if ( p -> error_count() != 3 || os.str() != "0 0" || u.parse({ "set", "-c", "1" }) -> error_count() != 0 )
+		fail("error count: " + std::to_string(p -> error_count()) + ", first '" + os.str() + "'");
+
+	if ( sizeof(usage_t::error_ref_t) > 16 )
+		fail("error_ref_t: " + std::to_string(sizeof(usage_t::error_ref_t)) + " bytes");
+}
+
+// "did you mean", from a usage_t and from its compiled image, only when asked
+static void expect_suggestions(const std::string& name, const std::string& best) {
+
+	static usage_t u = []() {
+		usage_t u = schema();
+		u.commands = {{ "install", nullptr }, { "remove", nullptr }};
+		return u;
+	}();
+	static auto compiled = usage_t::schema_t::compile(u);
+
+	for ( const auto& found : { u.suggest(name), compiled -> suggest(name) })
+		if ( found.empty() ? best != "" : found.front() != best )
+			fail("suggest " + name + ": " + ( found.empty() ? "(none)" : found.front()) + " (expected " + best + ")");
+}
+
+static void expect_explained() {
+
+	argv_t argv({ "--nme", "x" });
+	usage_t u = { .args = argv, .options = schema().options };
+
+	std::ostringstream plain, explained;
+	plain << u.errors();
+	explained << u.explain(u.errors());
+
+	if ( plain.str() != " --nme: unknown option" || explained.str() != " --nme: unknown option, did you mean --name?" )
+		fail("explain: '" + plain.str() + "', '" + explained.str() + "'");
+}
+
+// merge() leaves out what clashes, keys and words alike, and says with whom;
+// the rest is appended and the command line is checked again
+static void expect_merge() {
+
+	argv_t argv({ "-v", "--extra=x" });
+	usage_t u = { .args = argv, .options = schema().options, .commands = {{ "install", nullptr }}};
+
+	size_t before = u.error_count();
+
+	auto conflicts = u.merge({
+		{ .name = "log", .options = {{ "verbose", { .key = "v" }}}},
+		{ .name = "extra",
+			.options = {
+				{ "extra", { .word = "extra", .flag = usage_t::REQUIRED }},
+				{ "name", { .key = "N" }},
+				{ "again", { .key = "a" }},
+				{ "out", { .word = "o" }}
+			},
+			.commands = {{ "install", nullptr }, { "deploy", nullptr }}},
+		{ .name = "more", .options = {{ "verbose", { .key = "V" }}, { "loud", { .key = "v" }}}}
+	});
+
+	std::vector<std::string> expected = {
+		"name name  extra", "key a  extra", "word o  extra", "command install  extra",
+		"name verbose log more", "key v log more"
+	};
+	std::vector<std::string> found;
+
+	for ( const auto& c : conflicts )
+		found.push_back(c.what + " " + c.value + " " + c.module + " " + c.other);
+
+	if ( found != expected )
+		for ( size_t i = 0; i < std::max(found.size(), expected.size()); i++ )
+			if ( i >= found.size() || i >= expected.size() || found[i] != expected[i] )
+				fail("merge conflict " + std::to_string(i) + ": '" + ( i < found.size() ? found[i] : "(none)" ) +
+					"' (expected '" + ( i < expected.size() ? expected[i] : "(none)" ) + "')");
+
+	if ( u.options.size() != 7 || u.commands.size() != 2 || u.commands.back().first != "deploy" )
+		fail("merge: " + std::to_string(u.options.size()) + " options, " + std::to_string(u.commands.size()) + " commands (expected 7, 2)");
+
+	if ( before != 2 || u.error_count() != 0 || u.value("extra") != "x" )
+		fail("merge: " + std::to_string(before) + " then " + std::to_string(u.error_count()) + " errors, extra = " + u.value("extra"));
+}
+
+int main() {
+
+	// an attached short value may hold an =
+	expect({ "-ofoo=bar" }, "output", "foo=bar");
+	expect({ "-Dkey=val" }, "define", "key=val");
+	expect({ "-abofoo=bar" }, "output", "foo=bar");
+	expect({ "-abofoo=bar" }, "all", "");
+
+	// option=value, by word and by key
+	expect({ "--output=foo=bar" }, "output", "foo=bar");
+	expect({ "-o=foo" }, "output", "foo");
+	expect({ "--name=x" }, "name", "x");
+
+	// not an option either way
+	expect({ "--nothing=x" }, "nothing", "(none)", 1);
+	expect({ "-ab=c" }, "all", "(none)", 1);
+
+	// a later failing value drops the option, bound or not
+	expect_bound({ "-c", "5", "-c", "x" }, -1);
+	expect_bound({ "-c", "5", "-c" }, -1);
+	expect_bound({ "-c", "x", "-c", "7" }, 7);
+
+	expect_slots({ "f", "3", "1.5", "2" }, 0);
+	expect_slots({ "f", "x", "1.5", "y" }, 2);
+	expect_slots({ "f" }, 1);
+	expect_dispatched_slots();
+	expect_refused_slots();
+
+	expect_passthrough({ "-a", "raw", "-x", "--", "y" }, 2);
+	expect_passthrough({ "raw" }, 1);
+	expect_passthrough({ "-a", "x" }, -1);
+
+	expect_cache();
+	expect_handle();
+	expect_image();
+	expect_merge();
+
+	expect_fallback({}, "8080");
+	expect_fallback({ "-p", "1" }, "1");
+	expect_shared_fallback();
+
+	expect_suggestions("nme", "--name");
+	expect_suggestions("outptu", "--output");
+	expect_suggestions("instal", "install");
+	expect_suggestions("zzzzzz", "");
+	expect_explained();
+	expect_error_count();
+
+	return report();
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "usage.hpp"
+
+// What the checks under tests/ share: failures are counted and reported,
+// and a command line is handed to every entry point alike.
+
+static int failures = 0;
+
+static void fail(const std::string& what) {
+
+	std::cout << "FAIL " << what << std::endl;
+	failures++;
+}
+
+static int report() {
+
+	std::cout << ( failures == 0 ? "all tests passed" : std::to_string(failures) + " tests failed" ) << std::endl;
+	return failures == 0 ? 0 : 1;
+}
+
+// a command line as main() gets it, "test" being the program; kept alive
+// while a usage_t made from it is in use (see args_t's passthrough)
+struct argv_t {
+
+	std::vector<std::string> args;
+	std::vector<char*> argv;
+
+	argv_t(const std::vector<std::string>& args) : args(args) {
+
+		this -> argv.push_back((char*)"test");
+
+		for ( auto& a : this -> args )
+			this -> argv.push_back(a.data());
+		this -> argv.push_back(nullptr);
+	}
+
+	operator usage_t::args_t() {
+		return usage_t::args_t((int)this -> argv.size() - 1, this -> argv.data());
+	}
+
+	// as the command line reads, for messages
+	std::string str() const {
+
+		std::string s;
+
+		for ( const auto& a : this -> args )
+			s += ( s.empty() ? "" : " " ) + a;
+		return s;
+	}
+};
+
+// the results of args from each entry point building one: parse(args), a
+// compiled schema, incremental_t and cache_t - the schema made by make
+template <typename F>
+static std::vector<std::shared_ptr<const usage_t::parsed_t>> results(F make, const std::vector<std::string>& args) {
+
+	usage_t schema = make(usage_t::args_t());
+	usage_t::incremental_t incremental(schema);
+	usage_t::cache_t cache(schema);
+
+	return { schema.parse(args), usage_t::schema_t::compile(schema) -> parse(args), incremental.parse(args), cache.parse(args) };
+}